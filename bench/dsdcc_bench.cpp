@@ -0,0 +1,342 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Decoder throughput benchmark over the sample files. Results are printed in JSON.
+// Usage: dsdcc_bench [-s samples directory] [-r repeats] [-o output file]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <algorithm>
+#include <vector>
+
+#include "dsd_decoder.h"
+
+#ifndef DSDCC_SAMPLES_DIR
+#define DSDCC_SAMPLES_DIR "samples"
+#endif
+
+#define DSDCC_BENCH_BLOCK_SAMPLES 4800 // 100ms of signal pushed to the decoder at once as in dsdccx
+#define DSDCC_BENCH_SAMPLE_RATE 48000
+
+struct BenchFile
+{
+    const char *m_name;
+    DSDcc::DSDDecoder::DSDDecodeMode m_mode;
+    DSDcc::DSDDecoder::DSDRate m_rate;
+};
+
+static const BenchFile benchFiles[] = {
+    {"dmr_it_8.dis",      DSDcc::DSDDecoder::DSDDecodeDMR,   DSDcc::DSDDecoder::DSDRate4800},
+    {"dpmr.dis",          DSDcc::DSDDecoder::DSDDecodeDPMR,  DSDcc::DSDDecoder::DSDRate2400},
+    {"dstar_f1zil_1.dis", DSDcc::DSDDecoder::DSDDecodeDStar, DSDcc::DSDDecoder::DSDRate4800},
+    {"dstar_f1zil_2.dis", DSDcc::DSDDecoder::DSDDecodeDStar, DSDcc::DSDDecoder::DSDRate4800},
+};
+
+/** Results of one file and mode measured in a child process */
+struct BenchResult
+{
+    unsigned long m_nbSamples;
+    int m_nbFrames;
+    double m_seconds;
+    double m_latencies[4]; //!< p50, p90, p99 and max in seconds
+};
+
+static double getSeconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool readSamples(const char *path, std::vector<short>& samples)
+{
+    FILE *fp = fopen(path, "rb");
+
+    if (!fp) {
+        return false;
+    }
+
+    short buffer[4096];
+    size_t nbRead;
+
+    while ((nbRead = fread(buffer, sizeof(short), 4096, fp)) > 0) {
+        samples.insert(samples.end(), buffer, buffer + nbRead);
+    }
+
+    fclose(fp);
+    return samples.size() > 0;
+}
+
+static void setupDecoder(DSDcc::DSDDecoder& dsdDecoder, const BenchFile& benchFile, bool mbelib)
+{
+    dsdDecoder.setQuiet();
+    dsdDecoder.setLogVerbosity(0);
+    dsdDecoder.enableMbelib(mbelib);
+    dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeNone, true);
+    dsdDecoder.setDecodeMode(benchFile.m_mode, true);
+    dsdDecoder.setDataRate(benchFile.m_rate);
+}
+
+static int popFrames(DSDcc::DSDDecoder& dsdDecoder)
+{
+    DSDcc::DSDDecoder::DSDDVFrame frames[DSD_DVFRAME_QUEUE_SIZE];
+    int nbFrames = 0;
+
+    for (int slot = 0; slot < 2; slot++) {
+        nbFrames += dsdDecoder.popDVFrames(slot, frames, DSD_DVFRAME_QUEUE_SIZE);
+    }
+
+    dsdDecoder.resetAudio1();
+    dsdDecoder.resetAudio2();
+    return nbFrames;
+}
+
+/** Decode the whole file by blocks as dsdccx does. Returns the best time of the repeats */
+static double runThroughput(const BenchFile& benchFile, bool mbelib, const std::vector<short>& samples, int repeats, int& nbFrames)
+{
+    double bestTime = 0.0;
+    nbFrames = 0;
+
+    for (int r = 0; r < repeats; r++)
+    {
+        DSDcc::DSDDecoder *dsdDecoder = new DSDcc::DSDDecoder();
+        setupDecoder(*dsdDecoder, benchFile, mbelib);
+        nbFrames = 0;
+        double start = getSeconds();
+
+        for (size_t i = 0; i < samples.size(); i += DSDCC_BENCH_BLOCK_SAMPLES)
+        {
+            size_t blockSize = std::min(samples.size() - i, (size_t) DSDCC_BENCH_BLOCK_SAMPLES);
+            dsdDecoder->runBlock(&samples[i], blockSize);
+            nbFrames += popFrames(*dsdDecoder);
+        }
+
+        double time = getSeconds() - start;
+        bestTime = (r == 0) || (time < bestTime) ? time : bestTime;
+        delete dsdDecoder;
+    }
+
+    return bestTime;
+}
+
+/** Decode sample by sample and time the samples that complete a DV frame */
+static void runLatency(const BenchFile& benchFile, bool mbelib, const std::vector<short>& samples, std::vector<double>& latencies)
+{
+    DSDcc::DSDDecoder *dsdDecoder = new DSDcc::DSDDecoder();
+    setupDecoder(*dsdDecoder, benchFile, mbelib);
+
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        double start = getSeconds();
+        dsdDecoder->run(samples[i]);
+        double time = getSeconds() - start;
+
+        if (dsdDecoder->mbeDVReady1() || dsdDecoder->mbeDVReady2())
+        {
+            latencies.push_back(time);
+            dsdDecoder->resetMbeDV1();
+            dsdDecoder->resetMbeDV2();
+        }
+
+        if ((i % DSDCC_BENCH_BLOCK_SAMPLES) == 0) {
+            popFrames(*dsdDecoder);
+        }
+    }
+
+    delete dsdDecoder;
+    std::sort(latencies.begin(), latencies.end());
+}
+
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    if (sorted.size() == 0) {
+        return 0.0;
+    }
+
+    size_t index = (size_t) (p * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+/**
+ * Runs the measures of one file and mode in a child process so that its peak resident memory
+ * only covers this file samples and decoder. Returns false if the child failed
+ */
+static bool runChild(const char *path, const BenchFile& benchFile, bool mbelib, int repeats, BenchResult& result, long& peakRSSKiB)
+{
+    int fds[2];
+
+    if (pipe(fds) != 0) {
+        return false;
+    }
+
+    fflush(0); // do not duplicate buffered output in the child
+    pid_t pid = fork();
+
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+
+    if (pid == 0)
+    {
+        std::vector<short> samples;
+        std::vector<double> latencies;
+        close(fds[0]);
+
+        if (!readSamples(path, samples)) {
+            _exit(1);
+        }
+
+        result.m_nbSamples = samples.size();
+        result.m_seconds = runThroughput(benchFile, mbelib, samples, repeats, result.m_nbFrames);
+        runLatency(benchFile, mbelib, samples, latencies);
+        result.m_latencies[0] = percentile(latencies, 0.50);
+        result.m_latencies[1] = percentile(latencies, 0.90);
+        result.m_latencies[2] = percentile(latencies, 0.99);
+        result.m_latencies[3] = percentile(latencies, 1.0);
+        bool written = write(fds[1], &result, sizeof(result)) == (ssize_t) sizeof(result);
+        close(fds[1]);
+        _exit(written ? 0 : 1);
+    }
+
+    close(fds[1]);
+    bool received = read(fds[0], &result, sizeof(result)) == (ssize_t) sizeof(result);
+    close(fds[0]);
+
+    int status;
+    struct rusage usage;
+
+    if ((wait4(pid, &status, 0, &usage) != pid) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+        return false;
+    }
+
+    peakRSSKiB = usage.ru_maxrss; // KiB on Linux
+    return received;
+}
+
+static void usage()
+{
+    fprintf(stderr, "Usage: dsdcc_bench [options]\n");
+    fprintf(stderr, "  -s <dir>   Directory of the .dis sample files (default %s)\n", DSDCC_SAMPLES_DIR);
+    fprintf(stderr, "  -r <num>   Throughput runs per file, the best is kept (default 3)\n");
+    fprintf(stderr, "  -o <file>  Write the JSON results to file instead of stdout\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *samplesDir = DSDCC_SAMPLES_DIR;
+    int repeats = 3;
+    FILE *out = stdout;
+    int c;
+
+    while ((c = getopt(argc, argv, "hs:r:o:")) != -1)
+    {
+        switch (c)
+        {
+        case 's':
+            samplesDir = optarg;
+            break;
+        case 'r':
+            repeats = atoi(optarg) > 0 ? atoi(optarg) : 1;
+            break;
+        case 'o':
+            out = fopen(optarg, "w");
+
+            if (!out)
+            {
+                fprintf(stderr, "Cannot open %s\n", optarg);
+                return 1;
+            }
+
+            break;
+        default:
+            usage();
+            return 0;
+        }
+    }
+
+    fprintf(out, "{\n");
+#ifdef DSD_USE_MBELIB
+    fprintf(out, "  \"mbelibCompiled\": true,\n");
+#else
+    fprintf(out, "  \"mbelibCompiled\": false,\n");
+#endif
+    fprintf(out, "  \"sampleRate\": %d,\n", DSDCC_BENCH_SAMPLE_RATE);
+    fprintf(out, "  \"repeats\": %d,\n", repeats);
+    fprintf(out, "  \"results\": [");
+
+    bool first = true;
+
+    for (unsigned int f = 0; f < sizeof(benchFiles) / sizeof(BenchFile); f++)
+    {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", samplesDir, benchFiles[f].m_name);
+
+        if (access(path, R_OK) != 0)
+        {
+            fprintf(stderr, "dsdcc_bench: skipping %s (not found)\n", path);
+            continue;
+        }
+
+        for (int mbelib = 0; mbelib < 2; mbelib++)
+        {
+            BenchResult result;
+            long peakRSSKiB;
+
+            fprintf(stderr, "dsdcc_bench: %s mbelib %s\n", benchFiles[f].m_name, mbelib ? "on" : "off");
+
+            if (!runChild(path, benchFiles[f], mbelib != 0, repeats, result, peakRSSKiB))
+            {
+                fprintf(stderr, "dsdcc_bench: %s failed\n", path);
+                continue;
+            }
+
+            double samplesPerSecond = result.m_nbSamples / result.m_seconds;
+
+            fprintf(out, "%s\n    {\n", first ? "" : ",");
+            fprintf(out, "      \"file\": \"%s\",\n", benchFiles[f].m_name);
+            fprintf(out, "      \"mbelib\": %s,\n", mbelib ? "true" : "false");
+            fprintf(out, "      \"samples\": %lu,\n", result.m_nbSamples);
+            fprintf(out, "      \"dvFrames\": %d,\n", result.m_nbFrames);
+            fprintf(out, "      \"seconds\": %.6f,\n", result.m_seconds);
+            fprintf(out, "      \"samplesPerSecond\": %.0f,\n", samplesPerSecond);
+            fprintf(out, "      \"realTimeFactor\": %.2f,\n", samplesPerSecond / DSDCC_BENCH_SAMPLE_RATE);
+            fprintf(out, "      \"frameLatencyMicroseconds\": {\"p50\": %.2f, \"p90\": %.2f, \"p99\": %.2f, \"max\": %.2f},\n",
+                    result.m_latencies[0] * 1e6,
+                    result.m_latencies[1] * 1e6,
+                    result.m_latencies[2] * 1e6,
+                    result.m_latencies[3] * 1e6);
+            fprintf(out, "      \"peakRSSKiB\": %ld\n", peakRSSKiB);
+            fprintf(out, "    }");
+            first = false;
+        }
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    return 0;
+}
@@ -0,0 +1,610 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Microbenchmarks of the FEC, Viterbi and CRC primitives. Results are printed in JSON.
+// Block codes are decoded with 0 to t+1 bit errors per codeword. dataOK is the ratio of decodes giving back
+// the original data. Some syndrome tables only list errors on the data bits so it can be below 1 up to t errors.
+// Usage: dsdcc_fecbench [-t milliseconds per case] [-o output file]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "fec.h"
+#include "mbefec.h"
+#include "viterbi3.h"
+#include "viterbi5.h"
+#include "descramble.h"
+#include "crc.h"
+
+using namespace DSDcc;
+
+static const int nbVectors = 1024;          //!< test vectors cycled through in each case
+static double minSeconds = 0.1;             //!< minimum duration of each case
+static volatile uint32_t sink;              //!< keeps the results alive
+static FILE *out = stdout;
+static bool firstResult = true;
+
+static double getSeconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/** Runs op over the test vectors until minSeconds is elapsed. Returns the time per call in ns */
+template<typename Op>
+double measure(Op& op)
+{
+    unsigned long nbOps = 0;
+    double start = getSeconds();
+    double elapsed;
+
+    do
+    {
+        for (int i = 0; i < nbVectors; i++) {
+            op.run(i);
+        }
+
+        nbOps += nbVectors;
+        elapsed = getSeconds() - start;
+    } while (elapsed < minSeconds);
+
+    op.m_nbOps = nbOps;
+    return (elapsed * 1e9) / nbOps;
+}
+
+static void printResult(const char *primitive, const char *operation, int nbErrors, double ns, double okRatio)
+{
+    fprintf(out, "%s\n    {\"primitive\": \"%s\", \"operation\": \"%s\", \"errors\": %d, \"nsPerCall\": %.1f, \"dataOK\": %.4f}",
+            firstResult ? "" : ",", primitive, operation, nbErrors, ns, okRatio);
+    firstResult = false;
+}
+
+/** Flips nbErrors distinct bits among the n first bits */
+static void addErrors(unsigned char *bits, int n, int nbErrors)
+{
+    uint32_t flipped = 0;
+
+    for (int e = 0; e < nbErrors; e++)
+    {
+        int pos;
+
+        do {
+            pos = rand() % n;
+        } while (flipped & (1U << pos));
+
+        flipped |= 1U << pos;
+        bits[pos] ^= 1;
+    }
+}
+
+/** Spreads nbErrors bit errors over a long block */
+static void addErrorsBlock(unsigned char *bits, int n, int nbErrors, unsigned char one)
+{
+    for (int e = 0; e < nbErrors; e++)
+    {
+        int pos = rand() % n;
+        bits[pos] = bits[pos] ? 0 : one;
+    }
+}
+
+// ========================================================================================
+// Block codes of fec.h
+
+template<typename Code, int N, int K>
+struct FECVectors
+{
+    unsigned char m_dataBits[nbVectors][K];
+    unsigned char m_rxBits[nbVectors][N];
+    uint32_t m_data[nbVectors];
+    uint32_t m_rxWords[nbVectors];
+
+    void generate(Code& code, int nbErrors)
+    {
+        for (int i = 0; i < nbVectors; i++)
+        {
+            m_data[i] = rand() & ((1U << K) - 1);
+            FECBits::unpack(m_data[i], m_dataBits[i], K);
+            code.encode(m_dataBits[i], m_rxBits[i]);
+            addErrors(m_rxBits[i], N, nbErrors);
+            m_rxWords[i] = FECBits::pack(m_rxBits[i], N);
+        }
+    }
+};
+
+template<typename Code, int N, int K>
+struct FECEncode
+{
+    FECEncode(Code& code, FECVectors<Code, N, K>& vectors) : m_code(code), m_vectors(vectors), m_nbOK(0), m_nbOps(0) {}
+    void run(int i)
+    {
+        unsigned char encodedBits[N];
+        m_code.encode(m_vectors.m_dataBits[i], encodedBits);
+        sink += encodedBits[N-1];
+    }
+    Code& m_code;
+    FECVectors<Code, N, K>& m_vectors;
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+template<typename Code, int N, int K>
+struct FECEncodeWord
+{
+    FECEncodeWord(FECVectors<Code, N, K>& vectors) : m_vectors(vectors), m_nbOK(0), m_nbOps(0) {}
+    void run(int i)
+    {
+        sink += Code::encodeWord(m_vectors.m_data[i]);
+    }
+    FECVectors<Code, N, K>& m_vectors;
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+template<typename Code, bool InPlace>
+struct FECDecodeCall;
+
+template<typename Code>
+struct FECDecodeCall<Code, true> // corrects in place
+{
+    static void decode(Code& code, unsigned char *rxBits, unsigned char *) { code.decode(rxBits); }
+};
+
+template<typename Code>
+struct FECDecodeCall<Code, false> // produces the data bits
+{
+    static void decode(Code& code, unsigned char *rxBits, unsigned char *dataBits) { code.decode(rxBits, dataBits, 1); }
+};
+
+/** bit per byte decoding. Codes correcting in place (InPlace) or producing the data bits */
+template<typename Code, int N, int K, bool InPlace>
+struct FECDecode
+{
+    FECDecode(Code& code, FECVectors<Code, N, K>& vectors) : m_code(code), m_vectors(vectors), m_nbOK(0), m_nbOps(0) {}
+    void run(int i)
+    {
+        unsigned char rxBits[N], dataBits[N];
+        memcpy(rxBits, m_vectors.m_rxBits[i], N);
+        FECDecodeCall<Code, InPlace>::decode(m_code, rxBits, dataBits);
+        m_nbOK += memcmp(InPlace ? rxBits : dataBits, m_vectors.m_dataBits[i], K) == 0 ? 1 : 0;
+    }
+    Code& m_code;
+    FECVectors<Code, N, K>& m_vectors;
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+template<typename Code, int N, int K>
+struct FECDecodeWord
+{
+    FECDecodeWord(FECVectors<Code, N, K>& vectors) : m_vectors(vectors), m_nbOK(0), m_nbOps(0) {}
+    void run(int i)
+    {
+        uint32_t data = m_vectors.m_rxWords[i] >> (N - K); // left as received if not correctable like decode
+        Code::decodeWord(m_vectors.m_rxWords[i], data);
+        m_nbOK += data == m_vectors.m_data[i] ? 1 : 0;
+    }
+    FECVectors<Code, N, K>& m_vectors;
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+template<typename Code, int N, int K, bool InPlace>
+void benchBlockCode(const char *name, int t)
+{
+    Code code;
+    FECVectors<Code, N, K> *vectors = new FECVectors<Code, N, K>();
+
+    vectors->generate(code, 0);
+    FECEncode<Code, N, K> encode(code, *vectors);
+    printResult(name, "encode", 0, measure(encode), 1.0);
+    FECEncodeWord<Code, N, K> encodeWord(*vectors);
+    printResult(name, "encodeWord", 0, measure(encodeWord), 1.0);
+
+    for (int nbErrors = 0; nbErrors <= t + 1; nbErrors++)
+    {
+        vectors->generate(code, nbErrors);
+        FECDecode<Code, N, K, InPlace> decode(code, *vectors);
+        double ns = measure(decode);
+        printResult(name, "decode", nbErrors, ns, (double) decode.m_nbOK / decode.m_nbOps);
+        FECDecodeWord<Code, N, K> decodeWord(*vectors);
+        ns = measure(decodeWord);
+        printResult(name, "decodeWord", nbErrors, ns, (double) decodeWord.m_nbOK / decodeWord.m_nbOps);
+    }
+
+    delete vectors;
+}
+
+// ========================================================================================
+// AMBE FEC of mbefec.h. There is no encoder so codewords are built here from the generators.
+// Bit i of the 23 (15) bits block is in[i] and the data bits are the highest bits.
+
+static const int golayMBEGenerator[12] = {
+  0x63a, 0x31d, 0x7b4, 0x3da, 0x1ed, 0x6cc, 0x366, 0x1b3, 0x6e3, 0x54b, 0x49f, 0x475
+};
+
+static const int hammingMBEGenerator[4] = {
+  0x7f08, 0x78e4, 0x66d2, 0x55b1
+};
+
+static uint32_t encodeGolayMBE(uint32_t data)
+{
+    uint32_t parity = 0;
+
+    for (int i = 0; i < 12; i++)
+    {
+        if (data & (0x800 >> i)) {
+            parity ^= golayMBEGenerator[i];
+        }
+    }
+
+    return (data << 11) | parity;
+}
+
+static uint32_t encodeHammingMBE(uint32_t data)
+{
+    uint32_t block = data << 4;
+
+    for (int i = 0; i < 4; i++)
+    {
+        uint32_t parity = 0;
+
+        for (uint32_t x = block & hammingMBEGenerator[i]; x; x &= x - 1) {
+            parity ^= 1;
+        }
+
+        block |= parity << (3 - i);
+    }
+
+    return block;
+}
+
+struct MBEVectors
+{
+    unsigned char m_rxBits[nbVectors][23];
+    uint32_t m_data[nbVectors];
+
+    void generate(uint32_t (*encode)(uint32_t), int n, int k, int nbErrors)
+    {
+        for (int i = 0; i < nbVectors; i++)
+        {
+            m_data[i] = rand() & ((1U << k) - 1);
+            uint32_t block = encode(m_data[i]);
+
+            for (int b = 0; b < n; b++) {
+                m_rxBits[i][b] = (block >> b) & 1;
+            }
+
+            addErrors(m_rxBits[i], n, nbErrors);
+        }
+    }
+};
+
+struct MBEDecode
+{
+    MBEDecode(int (*decode)(unsigned char *, unsigned char *), MBEVectors& vectors, int n, int k) :
+        m_decode(decode), m_vectors(vectors), m_n(n), m_k(k), m_nbOK(0), m_nbOps(0) {}
+    void run(int i)
+    {
+        unsigned char outBits[23];
+        uint32_t data = 0;
+        m_decode(m_vectors.m_rxBits[i], outBits);
+
+        for (int b = m_n - 1; b >= m_n - m_k; b--) {
+            data = (data << 1) | outBits[b];
+        }
+
+        m_nbOK += data == m_vectors.m_data[i] ? 1 : 0;
+    }
+    int (*m_decode)(unsigned char *, unsigned char *);
+    MBEVectors& m_vectors;
+    int m_n;
+    int m_k;
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+static void benchMBECode(const char *name, int (*decode)(unsigned char *, unsigned char *), uint32_t (*encode)(uint32_t), int n, int k, int t)
+{
+    MBEVectors *vectors = new MBEVectors();
+
+    for (int nbErrors = 0; nbErrors <= t + 1; nbErrors++)
+    {
+        vectors->generate(encode, n, k, nbErrors);
+        MBEDecode mbeDecode(decode, *vectors, n, k);
+        double ns = measure(mbeDecode);
+        printResult(name, "decode", nbErrors, ns, (double) mbeDecode.m_nbOK / mbeDecode.m_nbOps);
+    }
+
+    delete vectors;
+}
+
+// ========================================================================================
+// Viterbi decoders on the D-Star header and YSF DCH block sizes
+
+static const int nbViterbiVectors = 16;
+static const int maxViterbiBits = 330;
+
+struct ViterbiVectors
+{
+    unsigned char m_dataBits[nbViterbiVectors][maxViterbiBits];
+    unsigned char m_codedBits[nbViterbiVectors][2*maxViterbiBits];
+    unsigned char m_softBits[nbViterbiVectors][2*maxViterbiBits];
+
+    void generate(Viterbi& viterbi, int nbBits, int nbErrors)
+    {
+        for (int i = 0; i < nbViterbiVectors; i++)
+        {
+            for (int b = 0; b < nbBits; b++) {
+                m_dataBits[i][b] = (b < nbBits - viterbi.getK() + 1) ? rand() & 1 : 0; // flushed
+            }
+
+            unsigned char symbols[maxViterbiBits];
+            viterbi.encodeToSymbols(symbols, m_dataBits[i], nbBits, 0); // encodeToBits does not follow msbFirst
+
+            for (int b = 0; b < 2*nbBits; b++)
+            {
+                m_codedBits[i][b] = (symbols[b/2] >> (b%2)) & 1; // bit j of the symbol is the j-th bit as in decodeFromBits
+                m_softBits[i][b] = m_codedBits[i][b] * 15;
+            }
+
+            addErrorsBlock(m_codedBits[i], 2*nbBits, nbErrors, 1);
+            addErrorsBlock(m_softBits[i], 2*nbBits, nbErrors, 15);
+        }
+    }
+};
+
+struct ViterbiDecode
+{
+    ViterbiDecode(Viterbi& viterbi, ViterbiVectors& vectors, int nbBits, bool soft) :
+        m_viterbi(viterbi), m_vectors(vectors), m_nbBits(nbBits), m_soft(soft), m_nbOK(0), m_nbOps(0) {}
+    void run(int i)
+    {
+        unsigned char dataBits[maxViterbiBits];
+        int v = i % nbViterbiVectors;
+
+        if (m_soft) {
+            m_viterbi.decodeFromSoftBits(dataBits, m_vectors.m_softBits[v], 2*m_nbBits, 0);
+        } else {
+            m_viterbi.decodeFromBits(dataBits, m_vectors.m_codedBits[v], 2*m_nbBits, 0);
+        }
+
+        m_nbOK += memcmp(dataBits, m_vectors.m_dataBits[v], m_nbBits) == 0 ? 1 : 0;
+    }
+    Viterbi& m_viterbi;
+    ViterbiVectors& m_vectors;
+    int m_nbBits;
+    bool m_soft;
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+struct DStarFECDecode
+{
+    DStarFECDecode(ViterbiVectors& vectors) : m_viterbi(Viterbi::Poly23a, false, 330), m_vectors(vectors), m_nbOK(0), m_nbOps(0) {}
+    void run(int i)
+    {
+        unsigned char dataBits[maxViterbiBits];
+        int v = i % nbViterbiVectors;
+        Descramble::FECdecoder(m_viterbi, m_vectors.m_codedBits[v], dataBits);
+        m_nbOK += memcmp(dataBits, m_vectors.m_dataBits[v], 330) == 0 ? 1 : 0;
+    }
+    Viterbi3 m_viterbi;
+    ViterbiVectors& m_vectors;
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+static void benchViterbi(const char *name, Viterbi& viterbi, int nbBits, int t, bool dstarFEC)
+{
+    ViterbiVectors *vectors = new ViterbiVectors();
+
+    for (int nbErrors = 0; nbErrors <= t + 1; nbErrors++)
+    {
+        vectors->generate(viterbi, nbBits, nbErrors);
+        ViterbiDecode hard(viterbi, *vectors, nbBits, false);
+        double ns = measure(hard);
+        printResult(name, "decodeFromBits", nbErrors, ns, (double) hard.m_nbOK / hard.m_nbOps);
+        ViterbiDecode soft(viterbi, *vectors, nbBits, true);
+        ns = measure(soft);
+        printResult(name, "decodeFromSoftBits", nbErrors, ns, (double) soft.m_nbOK / soft.m_nbOps);
+
+        if (dstarFEC)
+        {
+            DStarFECDecode fecDecode(*vectors);
+            ns = measure(fecDecode);
+            printResult("D-Star header", "FECdecoder", nbErrors, ns, (double) fecDecode.m_nbOK / fecDecode.m_nbOps);
+        }
+    }
+
+    delete vectors;
+}
+
+// ========================================================================================
+// D-Star header descrambling and CRCs on the protocols message sizes
+
+struct DStarDescramble
+{
+    DStarDescramble() : m_nbOK(0), m_nbOps(0)
+    {
+        for (int i = 0; i < 660; i++) {
+            m_bits[i] = rand() & 1;
+        }
+    }
+    void run(int i)
+    {
+        unsigned char scrambled[660], deinterleaved[660];
+        Descramble::scramble(m_bits, scrambled);
+        Descramble::deinterleave(scrambled, deinterleaved);
+        sink += deinterleaved[i % 660];
+    }
+    unsigned char m_bits[660];
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+struct CRCBits
+{
+    CRCBits(CRC& crc, int nbBits) : m_crc(crc), m_nbBits(nbBits), m_nbOK(0), m_nbOps(0)
+    {
+        for (int i = 0; i < 160; i++) {
+            m_bits[i] = rand() & 1;
+        }
+    }
+    void run(int)
+    {
+        sink += m_crc.crcbits(m_bits, m_nbBits);
+    }
+    CRC& m_crc;
+    int m_nbBits;
+    unsigned char m_bits[160];
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+struct CRCBytes
+{
+    CRCBytes(CRC& crc, int nbBytes, bool bitByBit) : m_crc(crc), m_nbBytes(nbBytes), m_bitByBit(bitByBit), m_nbOK(0), m_nbOps(0)
+    {
+        for (int i = 0; i < 64; i++) {
+            m_bytes[i] = rand() & 0xff;
+        }
+    }
+    void run(int)
+    {
+        sink += m_bitByBit ? m_crc.crcbitbybitfast(m_bytes, m_nbBytes) : m_crc.crctablefast(m_bytes, m_nbBytes);
+    }
+    CRC& m_crc;
+    int m_nbBytes;
+    bool m_bitByBit;
+    unsigned char m_bytes[64];
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+struct DStarCRCCheck
+{
+    DStarCRCCheck() : m_nbOK(0), m_nbOps(0)
+    {
+        for (int i = 0; i < 41; i++) {
+            m_header[i] = rand() & 0xff;
+        }
+    }
+    void run(int)
+    {
+        m_nbOK += m_crc.check_crc(m_header, 41) ? 1 : 0;
+    }
+    DStarCRC m_crc;
+    unsigned char m_header[41];
+    unsigned long m_nbOK;
+    unsigned long m_nbOps;
+};
+
+static void benchCRCs()
+{
+    CRC crcYSF(CRC::PolyCCITT16, 16, 0x0, 0xffff);
+    CRC crcDPMR7(CRC::PolyDPMR7, 7, 0, 0);
+    CRC crcDPMR8(CRC::PolyDPMR8, 8, 0, 0);
+
+    CRCBits ysfFICH(crcYSF, 32);
+    printResult("CRC16 YSF FICH", "crcbits", 0, measure(ysfFICH), 1.0);
+    CRCBits ysfDCH(crcYSF, 160);
+    printResult("CRC16 YSF DCH", "crcbits", 0, measure(ysfDCH), 1.0);
+    CRCBytes ysfDCHBytes(crcYSF, 20, false);
+    printResult("CRC16 YSF DCH", "crctablefast", 0, measure(ysfDCHBytes), 1.0);
+    CRCBytes ysfDCHBitByBit(crcYSF, 20, true);
+    printResult("CRC16 YSF DCH", "crcbitbybitfast", 0, measure(ysfDCHBitByBit), 1.0);
+    CRCBits dpmr7(crcDPMR7, 41);
+    printResult("CRC7 dPMR", "crcbits", 0, measure(dpmr7), 1.0);
+    CRCBits dpmr8(crcDPMR8, 72);
+    printResult("CRC8 dPMR", "crcbits", 0, measure(dpmr8), 1.0);
+    DStarCRCCheck dstarCRC;
+    printResult("CRC16 D-Star header", "check_crc", 0, measure(dstarCRC), 1.0);
+}
+
+static void usage()
+{
+    fprintf(stderr, "Usage: dsdcc_fecbench [options]\n");
+    fprintf(stderr, "  -t <ms>    Minimum duration of each case in milliseconds (default 100)\n");
+    fprintf(stderr, "  -o <file>  Write the JSON results to file instead of stdout\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int c;
+
+    while ((c = getopt(argc, argv, "ht:o:")) != -1)
+    {
+        switch (c)
+        {
+        case 't':
+            minSeconds = atoi(optarg) > 0 ? atoi(optarg) / 1000.0 : 0.001;
+            break;
+        case 'o':
+            out = fopen(optarg, "w");
+
+            if (!out)
+            {
+                fprintf(stderr, "Cannot open %s\n", optarg);
+                return 1;
+            }
+
+            break;
+        default:
+            usage();
+            return 0;
+        }
+    }
+
+    srand(1); // same test vectors at each run
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"minMillisecondsPerCase\": %.0f,\n", minSeconds * 1000.0);
+    fprintf(out, "  \"results\": [");
+
+    benchBlockCode<Hamming_7_4, 7, 4, true>("Hamming (7,4)", 1);
+    benchBlockCode<Hamming_12_8, 12, 8, false>("Hamming (12,8)", 1);
+    benchBlockCode<Hamming_15_11, 15, 11, false>("Hamming (15,11)", 1);
+    benchBlockCode<Hamming_16_11_4, 16, 11, false>("Hamming (16,11,4)", 1);
+    benchBlockCode<Golay_20_8, 20, 8, true>("Golay (20,8)", 3);
+    benchBlockCode<Golay_23_12, 23, 12, true>("Golay (23,12)", 3);
+    benchBlockCode<Golay_24_12, 24, 12, true>("Golay (24,12)", 3);
+    benchBlockCode<QR_16_7_6, 16, 7, true>("QR (16,7,6)", 2);
+
+    benchMBECode("GolayMBE (23,12)", GolayMBE::mbe_golay2312, encodeGolayMBE, 23, 12, 3);
+    benchMBECode("HammingMBE (15,11)", HammingMBE::mbe_hamming1511, encodeHammingMBE, 15, 11, 1);
+
+    Viterbi3 viterbiDStar(Viterbi::Poly23a, false, 330);
+    Viterbi5 viterbiYSF(Viterbi::Poly25y, true, 180);
+    benchViterbi("Viterbi K=3 D-Star header", viterbiDStar, 330, 2, true);
+    benchViterbi("Viterbi K=5 YSF DCH", viterbiYSF, 180, 3, false);
+
+    DStarDescramble descramble;
+    printResult("D-Star header", "scramble+deinterleave", 0, measure(descramble), 1.0);
+
+    benchCRCs();
+
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    return 0;
+}
@@ -19,6 +19,8 @@
 #ifndef CRC_H_
 #define CRC_H_
 
+#include <stdint.h>
+
 namespace DSDcc
 {
 
@@ -74,9 +76,14 @@ public:
     unsigned long crctable(unsigned char* p, unsigned long len);
 
     /** fast lookup table algorithm without augmented zero bytes, e.g. used in pkzip.
-    * only usable with polynomial orders of 8, 16, 24 or 32.
+    * processes 8 bytes per step with slicing-by-8 tables. Usable with polynomial orders between 1...32.
     */
-    unsigned long crctablefast(unsigned char* p, unsigned long len);
+    unsigned long crctablefast(const unsigned char* p, unsigned long len);
+
+    /** same as crctablefast with one bit per byte input in the order of processing (MSB first in each byte
+    * or LSB first if input is reflected). nbBits does not have to be a multiple of 8.
+    */
+    unsigned long crcbits(const unsigned char* bits, unsigned long nbBits);
 
     /** bit by bit algorithm with augmented zero bytes.
     * does not use lookup table, suited for polynomial orders between 1...32.
@@ -90,11 +97,21 @@ public:
 
     static const unsigned long PolyCCITT16;
     static const unsigned long PolyDStar16;
+    static const unsigned long PolyDPMR7;  //!< X^7+X^3+1
+    static const unsigned long PolyDPMR8;  //!< X^8+X^2+X+1
 
 private:
+    CRC(const CRC&);
+    CRC& operator=(const CRC&);
+
     unsigned long reflect(unsigned long crc, int bitnum);
     void generate_crc_table();
     void init();
+    uint32_t startRegister();
+    unsigned long finalRegister(uint32_t crc);
+    uint32_t slice8(uint32_t crc, uint64_t block); //!< 8 bytes in one step. First byte is the MSB of block (the LSB if input is reflected)
+    uint32_t slice1(uint32_t crc, unsigned char byte);
+    unsigned char packByte(const unsigned char *bits); //!< 8 bits of bit per byte input in processing order
 
     int           m_order;   //!< CRC order (# bits) or polynomial order
     unsigned long m_poly;    //!< Polynomial in binary form with implicit order ex: X^16+X^12+X^5+1 -> (1)0001 0000 0010 0001 = 0x1021
@@ -108,12 +125,23 @@ private:
     unsigned long m_crchighbit;
     unsigned long m_crcinit_direct;
     unsigned long m_crcinit_nondirect;
-    unsigned long m_crctab[256];
+    int           m_alignShift;   //!< non reflected register is left aligned on a multiple of 8 bits for table lookups
+    uint32_t      m_alignedMask;
+    uint32_t      m_alignedPoly;  //!< polynomial left aligned or reflected if input is reflected
+    const uint32_t (*m_crctab)[256];  //!< slicing-by-8 lookup tables. Precomputed for protocols CRCs else m_crctabGenerated
+    uint32_t (*m_crctabGenerated)[256];
+
+    static const uint32_t m_crctabCCITT16[8][256];          //!< CCITT16 without input reflection (YSF)
+    static const uint32_t m_crctabCCITT16Reflected[8][256]; //!< CCITT16 with input reflection (D-Star)
+    static const uint32_t m_crctabDPMR7[8][256];
+    static const uint32_t m_crctabDPMR8[8][256];
 };
 
 /* D-Star specific CRC16 calculation. It is so weird that I just copied it from:
  *     https://github.com/f4goh/DSTAR
  * Many thanks to Anthony, F4GOH!
+ * The original bit by bit computation is CCITT16 with reflected input and output, 0xffff initial
+ * value and final XOR so it is now done with the table driven CRC.
  */
 class DStarCRC
 {
@@ -125,11 +153,10 @@ public:
 	bool check_crc(unsigned char *array, int size_buffer, unsigned int crcVlaue);
 
 private:
-	unsigned char bitRead(unsigned char value, unsigned int bit) { return (((value) >> (bit)) & 0x01); }
-	void fcsbit(unsigned char tbyte);
 	void compute_crc(unsigned char *array, int size_buffer);
 
 	unsigned int crc;
+	CRC m_crc; //!< X-modem CRC poly reflected processing LSB first is CCITT16 with reflected input and output
 };
 
 
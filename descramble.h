@@ -17,6 +17,8 @@
 #ifndef DSDCC_DESCRAMBLE_H_
 #define DSDCC_DESCRAMBLE_H_
 
+#include "viterbi3.h"
+
 namespace DSDcc
 {
 
@@ -24,23 +26,13 @@ class Descramble
 {
 public:
     static void scramble (unsigned char *in, unsigned char *out);
+    static void scrambleSoft (unsigned char *in, unsigned char *out, unsigned char softMax = 15); //!< same on soft bits (0..softMax)
     static void deinterleave (unsigned char *in, unsigned char *out);
-    static int FECdecoder (unsigned char *in, unsigned char *out);
+    static int FECdecoder (unsigned char *in, unsigned char *out); //!< hard decision Viterbi decoding of the 660 header bits into 330 bits
+    /** Same with a caller owned Viterbi3(Viterbi::Poly23a, false, 330) reused for each header to save its set up */
+    static int FECdecoder (Viterbi3& viterbi, unsigned char *in, unsigned char *out);
 
 private:
-    static int traceBack (unsigned char *out,
-            unsigned char *m_pathMemory0,
-            unsigned char *m_pathMemory1,
-            unsigned char *m_pathMemory2,
-            unsigned char *m_pathMemory3);
-    static void viterbiDecode (int n,
-            unsigned char *data,
-            unsigned char *m_pathMemory0,
-            unsigned char *m_pathMemory1,
-            unsigned char *m_pathMemory2,
-            unsigned char *m_pathMemory3,
-            unsigned char *m_pathMetric);
-
     static const int SCRAMBLER_TABLE_BITS_LENGTH=720;
     static const unsigned char SCRAMBLER_TABLE_BITS[];
 };
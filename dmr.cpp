@@ -358,14 +358,14 @@ void DSDDMR::processSyncOrSkip()
 {
 	if (m_symbolIndex > 24) // accumulate enough symbols to look for a sync
 	{
-		if (memcmp(m_dsdDecoder->m_dsdSymbol.getSyncDibitBack(24), DSDDecoder::m_syncDMRDataBS, 24) == 0)
+		if (m_dsdDecoder->isSyncPattern(DSDDecoder::DSDSyncPatternDMRDataBS))
 		{
 //		    std::cerr << "DSDDMR::processSyncOrSkip: data sync" << std::endl;
 			processDataFirstHalf(90);
 			m_dsdDecoder->m_fsmState = DSDDecoder::DSDprocessDMRdata;
 			return;
 		}
-		else if (memcmp(m_dsdDecoder->m_dsdSymbol.getSyncDibitBack(24), DSDDecoder::m_syncDMRVoiceBS, 24) == 0)
+		else if (m_dsdDecoder->isSyncPattern(DSDDecoder::DSDSyncPatternDMRVoiceBS))
 		{
 //		    std::cerr << "DSDDMR::processSyncOrSkip: voice sync" << std::endl;
 			processVoiceFirstHalf(90);
@@ -649,13 +649,13 @@ void DSDDMR::processVoiceDibit(unsigned char dibit)
 		{
 		    if (m_slot == DSDDMRSlot1)
 		    {
+		        m_dsdDecoder->pushDVFrame(0); // Indicate that a DVSI frame is available
 		        m_dsdDecoder->m_mbeDecoder1.processFrame(0, m_dsdDecoder->ambe_fr, 0);
-		        m_dsdDecoder->m_mbeDVReady1 = true; // Indicate that a DVSI frame is available
 		    }
 		    else if (m_slot == DSDDMRSlot2)
 		    {
+		        m_dsdDecoder->pushDVFrame(1); // Indicate that a DVSI frame is available
 		        m_dsdDecoder->m_mbeDecoder2.processFrame(0, m_dsdDecoder->ambe_fr, 0);
-		        m_dsdDecoder->m_mbeDVReady2 = true; // Indicate that a DVSI frame is available
 		    }
 		}
 	}
@@ -758,15 +758,15 @@ void DSDDMR::processVoiceDibit(unsigned char dibit)
 		{
 			if (m_slot == DSDDMRSlot1)
 			{
-				m_dsdDecoder->m_mbeDecoder1.processFrame(0, m_dsdDecoder->ambe_fr, 0);
 				memcpy(m_dsdDecoder->m_mbeDVFrame1, m_mbeDVFrame, 9);
-				m_dsdDecoder->m_mbeDVReady1 = true; // Indicate that a DVSI frame is available
+				m_dsdDecoder->pushDVFrame(0); // Indicate that a DVSI frame is available
+				m_dsdDecoder->m_mbeDecoder1.processFrame(0, m_dsdDecoder->ambe_fr, 0);
 			}
 			else if (m_slot == DSDDMRSlot2)
 			{
-				m_dsdDecoder->m_mbeDecoder2.processFrame(0, m_dsdDecoder->ambe_fr, 0);
 				memcpy(m_dsdDecoder->m_mbeDVFrame2, m_mbeDVFrame, 9);
-				m_dsdDecoder->m_mbeDVReady2 = true; // Indicate that a DVSI frame is available
+				m_dsdDecoder->pushDVFrame(1); // Indicate that a DVSI frame is available
+				m_dsdDecoder->m_mbeDecoder2.processFrame(0, m_dsdDecoder->ambe_fr, 0);
 			}
 		}
 	}
@@ -808,13 +808,13 @@ void DSDDMR::processVoiceDibit(unsigned char dibit)
 		{
 		    if (m_slot == DSDDMRSlot1)
 		    {
+		        m_dsdDecoder->pushDVFrame(0); // Indicate that a DVSI frame is available
 		        m_dsdDecoder->m_mbeDecoder1.processFrame(0, m_dsdDecoder->ambe_fr, 0);
-		        m_dsdDecoder->m_mbeDVReady1 = true; // Indicate that a DVSI frame is available
 		    }
 		    else if (m_slot == DSDDMRSlot2)
 		    {
+		        m_dsdDecoder->pushDVFrame(1); // Indicate that a DVSI frame is available
 		        m_dsdDecoder->m_mbeDecoder2.processFrame(0, m_dsdDecoder->ambe_fr, 0);
-		        m_dsdDecoder->m_mbeDVReady2 = true; // Indicate that a DVSI frame is available
 		    }
 		}
 	}
@@ -836,26 +836,28 @@ void DSDDMR::decodeCACH(unsigned char *cachBits)
     else
     {
         // Hamming (7,4) decode and store results if successful
-        if (m_hamming_7_4.decode(cachBits)) // positive CACH information
+        uint32_t tact;
+
+        if (m_dsdDecoder->decodeFEC<Hamming_7_4>(DSDDecoder::DSDFECHamming, FECBits::pack(cachBits, 7), tact) >= 0) // positive CACH information
         {
-            unsigned int slotIndex = cachBits[1] & 1;
+            unsigned int slotIndex = (tact >> 2) & 1;
             m_dsdDecoder->m_state.currentslot = slotIndex; // FIXME: remove this when done with new voice processing
 
             if (slotIndex)
             {
                 m_slotText = m_dsdDecoder->m_state.slot1light;
-                m_dsdDecoder->m_state.slot0light[0] = ((cachBits[0] & 1) ? '*' : '.'); // the activity indicator is shifted by one slot
+                m_dsdDecoder->m_state.slot0light[0] = (((tact >> 3) & 1) ? '*' : '.'); // the activity indicator is shifted by one slot
             }
             else
             {
                 m_slotText = m_dsdDecoder->m_state.slot0light;
-                m_dsdDecoder->m_state.slot1light[0] = ((cachBits[0] & 1) ? '*' : '.'); // the activity indicator is shifted by one slot
+                m_dsdDecoder->m_state.slot1light[0] = (((tact >> 3) & 1) ? '*' : '.'); // the activity indicator is shifted by one slot
             }
 
             m_slot = (DSDDMRSlot) slotIndex;
-            m_lcss = 2*cachBits[2] + cachBits[3];
+            m_lcss = tact & 3;
 
-//            std::cerr << "DSDDMR::decodeCACH: cach: " << " OK: at: " << m_cachSymbolIndex << " Slot: " << (int) cachBits[1] << " LCSS: " << (int) m_lcss << std::endl;
+//            std::cerr << "DSDDMR::decodeCACH: cach: " << " OK: at: " << m_cachSymbolIndex << " Slot: " << slotIndex << " LCSS: " << (int) m_lcss << std::endl;
 
             m_cachSymbolIndex = 0; // restart counting
         }
@@ -870,20 +872,22 @@ void DSDDMR::decodeCACH(unsigned char *cachBits)
 
 void DSDDMR::processSlotTypePDU()
 {
-    unsigned char slotTypeBits[20];
+    uint32_t slotTypeWord = 0;
 
-    for (int i = 0; i < 10; i++)
-    {
-        slotTypeBits[2*i]     = (m_slotTypePDU_dibits[i] >> 1) & 1;
-        slotTypeBits[2*i + 1] = m_slotTypePDU_dibits[i] & 1;
+    for (int i = 0; i < 10; i++) {
+        slotTypeWord = (slotTypeWord << 2) | (m_slotTypePDU_dibits[i] & 3);
     }
 
-    if (m_golay_20_8.decode(slotTypeBits))
+    uint32_t slotType;
+    bool slotTypeOK = m_dsdDecoder->decodeFEC<Golay_20_8>(DSDDecoder::DSDFECGolay, slotTypeWord, slotType) >= 0;
+    m_dsdDecoder->countCheck(DSDDecoder::DSDCheckDMRSlotType, slotTypeOK);
+
+    if (slotTypeOK)
     {
-        m_colorCode = (slotTypeBits[0] << 3) + (slotTypeBits[1] << 2) + (slotTypeBits[2] << 1) + slotTypeBits[3];
+        m_colorCode = (slotType >> 4) & 0xF;
         sprintf(&m_slotText[1], "%02d ", m_colorCode);
 
-        unsigned int dataType = (slotTypeBits[4] << 3) + (slotTypeBits[5] << 2) + (slotTypeBits[6] << 1) + slotTypeBits[7];
+        unsigned int dataType = slotType & 0xF;
 
         if (dataType > 10)
         {
@@ -907,20 +911,20 @@ void DSDDMR::processSlotTypePDU()
 
 bool DSDDMR::processEMB()
 {
-    unsigned char embBits[16];
+    uint32_t embWord = 0;
 
-    for (int i = 0; i < 8; i++)
-    {
-        embBits[2*i]     = (m_emb_dibits[i] >> 1) & 1;
-        embBits[2*i + 1] = m_emb_dibits[i] & 1;
+    for (int i = 0; i < 8; i++) {
+        embWord = (embWord << 2) | (m_emb_dibits[i] & 3);
     }
 
-    if (m_qr_16_7_6.decode(embBits))
+    uint32_t emb;
+
+    if (m_dsdDecoder->decodeFEC<QR_16_7_6>(DSDDecoder::DSDFECQR, embWord, emb) >= 0)
     {
-        m_colorCode = (embBits[0] << 3) + (embBits[1] << 2) + (embBits[2] << 1) + embBits[3];
+        m_colorCode = (emb >> 3) & 0xF;
         sprintf(&m_slotText[1], "%02d", m_colorCode);
         m_slotText[3] = ' ';
-        m_lcss = (embBits[5] << 1) + embBits[6];
+        m_lcss = emb & 3;
         return true;
     }
     else
@@ -971,63 +975,26 @@ bool DSDDMR::processVoiceEmbeddedSignalling(int& voiceEmbSig_dibitsIndex,
 
         if (voiceEmbSig_dibitsIndex == 16*4) // BPTC matrix collected
         {
-            if (m_hamming_16_11_4.decode(voiceEmbSigRawBits, 0, 7)) // TODO: 5 bit checksum
+            uint32_t rows[7]; // data bits of the BPTC rows
+            int ir = 0;
+
+            for (; ir < 7; ir++)
+            {
+                if (m_dsdDecoder->decodeFEC<Hamming_16_11_4>(DSDDecoder::DSDFECHamming, FECBits::pack(&voiceEmbSigRawBits[16*ir], 16), rows[ir]) < 0) {
+                    break;
+                }
+            }
+
+            if (ir == 7) // TODO: 5 bit checksum
             {
-                unsigned char flco = (voiceEmbSigRawBits[2] << 5)
-                        + (voiceEmbSigRawBits[3] << 4)
-                        + (voiceEmbSigRawBits[4] << 3)
-                        + (voiceEmbSigRawBits[5] << 2)
-                        + (voiceEmbSigRawBits[6] << 1)
-                        + (voiceEmbSigRawBits[7]);
+                unsigned char flco = (rows[0] >> 3) & 0x3F;
                 addresses.m_group = (flco == 0);
-                addresses.m_target = (voiceEmbSigRawBits[16*2 + 2] << 23) // (LC47)
-                        + (voiceEmbSigRawBits[16*2 + 3] << 22)
-                        + (voiceEmbSigRawBits[16*2 + 4] << 21)
-                        + (voiceEmbSigRawBits[16*2 + 5] << 20)
-                        + (voiceEmbSigRawBits[16*2 + 6] << 19)
-                        + (voiceEmbSigRawBits[16*2 + 7] << 18)
-                        + (voiceEmbSigRawBits[16*2 + 8] << 17)
-                        + (voiceEmbSigRawBits[16*2 + 9] << 16) // 2:7
-                        + (voiceEmbSigRawBits[16*3 + 0] << 15) // (LC39)
-                        + (voiceEmbSigRawBits[16*3 + 1] << 14)
-                        + (voiceEmbSigRawBits[16*3 + 2] << 13)
-                        + (voiceEmbSigRawBits[16*3 + 3] << 12)
-                        + (voiceEmbSigRawBits[16*3 + 4] << 11)
-                        + (voiceEmbSigRawBits[16*3 + 5] << 10)
-                        + (voiceEmbSigRawBits[16*3 + 6] << 9)
-                        + (voiceEmbSigRawBits[16*3 + 7] << 8)  // 1:7
-                        + (voiceEmbSigRawBits[16*3 + 8] << 7)  // (LC31)
-                        + (voiceEmbSigRawBits[16*3 + 9] << 6)
-                        + (voiceEmbSigRawBits[16*4 + 0] << 5)  // (LC29)
-                        + (voiceEmbSigRawBits[16*4 + 1] << 4)
-                        + (voiceEmbSigRawBits[16*4 + 2] << 3)
-                        + (voiceEmbSigRawBits[16*4 + 3] << 2)
-                        + (voiceEmbSigRawBits[16*4 + 4] << 1)
-                        + (voiceEmbSigRawBits[16*4 + 5]);      // (LC24)
-                addresses.m_source = (voiceEmbSigRawBits[16*4 + 6] << 23) // (LC23)
-                        + (voiceEmbSigRawBits[16*4 + 7] << 22)
-                        + (voiceEmbSigRawBits[16*4 + 8] << 21)
-                        + (voiceEmbSigRawBits[16*4 + 9] << 20)
-                        + (voiceEmbSigRawBits[16*5 + 0] << 19)
-                        + (voiceEmbSigRawBits[16*5 + 1] << 18)
-                        + (voiceEmbSigRawBits[16*5 + 2] << 17)
-                        + (voiceEmbSigRawBits[16*5 + 3] << 16) // 2:7
-                        + (voiceEmbSigRawBits[16*5 + 4] << 15) // (LC15)
-                        + (voiceEmbSigRawBits[16*5 + 5] << 14)
-                        + (voiceEmbSigRawBits[16*5 + 6] << 13)
-                        + (voiceEmbSigRawBits[16*5 + 7] << 12)
-                        + (voiceEmbSigRawBits[16*5 + 8] << 11)
-                        + (voiceEmbSigRawBits[16*5 + 9] << 10)
-                        + (voiceEmbSigRawBits[16*6 + 0] << 9)
-                        + (voiceEmbSigRawBits[16*6 + 1] << 8)  // 1:7
-                        + (voiceEmbSigRawBits[16*6 + 2] << 7)  // (LC7)
-                        + (voiceEmbSigRawBits[16*6 + 3] << 6)
-                        + (voiceEmbSigRawBits[16*6 + 4] << 5)
-                        + (voiceEmbSigRawBits[16*6 + 5] << 4)
-                        + (voiceEmbSigRawBits[16*6 + 6] << 3)
-                        + (voiceEmbSigRawBits[16*6 + 7] << 2)
-                        + (voiceEmbSigRawBits[16*6 + 8] << 1)
-                        + (voiceEmbSigRawBits[16*6 + 9]);      // (LC0)
+                addresses.m_target = (((rows[2] >> 1) & 0xFF) << 16) // LC47..LC40 in row 2 bits 2:9
+                        + (((rows[3] >> 1) & 0x3FF) << 6)            // LC39..LC30 in row 3 bits 0:9
+                        + ((rows[4] >> 5) & 0x3F);                   // LC29..LC24 in row 4 bits 0:5
+                addresses.m_source = (((rows[4] >> 1) & 0xF) << 20) // LC23..LC20 in row 4 bits 6:9
+                        + (((rows[5] >> 1) & 0x3FF) << 10)           // LC19..LC10 in row 5 bits 0:9
+                        + ((rows[6] >> 1) & 0x3FF);                  // LC9..LC0 in row 6 bits 0:9
 
                 return true; // we have a result
             }
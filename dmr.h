@@ -130,11 +130,6 @@ private:
     unsigned int m_voice2FrameCount; //!< current frame count in voice superframe: [0..5] else no superframe on going
     unsigned char m_mbeDVFrame[9];
 
-    Hamming_7_4 m_hamming_7_4;
-    Golay_20_8 m_golay_20_8;
-    QR_16_7_6 m_qr_16_7_6;
-    Hamming_16_11_4 m_hamming_16_11_4;
-
     const int *w, *x, *y, *z;
 
     static const int m_cachInterleave[24];
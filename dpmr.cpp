@@ -86,6 +86,8 @@ DSDdPMR::DSDdPMR(DSDDecoder *dsdDecoder) :
         m_symbolIndex(0),
         m_frameIndex(0),
         m_colourCode(0),
+        m_crc7(CRC::PolyDPMR7, 7, 0, 0),
+        m_crc8(CRC::PolyDPMR8, 8, 0, 0),
         m_calledId(0),
         m_ownId(0),
         m_calledIdHalf(false),
@@ -188,7 +190,7 @@ void DSDdPMR::processHIn(int symbolIndex, int dibit) // FIXME
 
     if (symbolIndex == 59)
     {
-        bool hammingStatus = m_hamming.decode(m_bitBufferRx, m_bitBuffer, 10);
+        bool hammingStatus = decodeHamming(10);
 
         if (checkCRC8(m_bitBuffer, 72)) // CRC8 check OK
         {
@@ -528,7 +530,7 @@ void DSDdPMR::processCCH(int symbolIndex, int dibit)
 
     if (symbolIndex == 35)
     {
-        bool hammingStatus = m_hamming.decode(m_bitBufferRx, m_bitBuffer, 6);
+        bool hammingStatus = decodeHamming(6);
 
         if (checkCRC7(m_bitBuffer, 41)) // CRC7 check OK
         {
@@ -714,8 +716,8 @@ void DSDdPMR::processVoiceFrame(int symbolIndex, int dibit)
 
     if (symbolIndex % 36 == 35)
     {
+        m_dsdDecoder->pushDVFrame(0); // Indicate that a DVSI frame is available
         m_dsdDecoder->m_mbeDecoder1.processFrame(0, m_dsdDecoder->ambe_fr, 0);
-        m_dsdDecoder->m_mbeDVReady1 = true; // Indicate that a DVSI frame is available
 
         if (m_dsdDecoder->m_opts.errorbars == 1)
         {
@@ -766,53 +768,38 @@ void DSDdPMR::initInterleaveIndexes()
 
 bool DSDdPMR::checkCRC7(unsigned char *bits, int nbBits)
 {
-    memcpy(m_bitWork, bits, nbBits);
-    memset(&m_bitWork[nbBits], 0, 7);
-
-    for (int i = 0; i < nbBits; i++)
-    {
-        if (m_bitWork[i] == 1) // divide by X^7+X^3+1 (10001001)
-        {
-            m_bitWork[i]    = 0; // X^8
-            m_bitWork[i+4] ^= 1; // X^3
-            m_bitWork[i+7] ^= 1; // 1
-        }
-    }
-
-    if (memcmp(&bits[nbBits], &m_bitWork[nbBits], 7) == 0) // CRC OK
-    {
-        return true;
-    }
-    else
-    {
-        return false;
-    }
+    DSD_PERF_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfCRC);
+    // divide by X^7+X^3+1 (10001001)
+    bool ok = m_crc7.crcbits(bits, nbBits) == FECBits::pack(&bits[nbBits], 7);
+    m_dsdDecoder->countCheck(DSDDecoder::DSDCheckDPMRCRC7, ok);
+    return ok;
 }
 
 bool DSDdPMR::checkCRC8(unsigned char *bits, int nbBits)
 {
-    memcpy(m_bitWork, bits, nbBits);
-    memset(&m_bitWork[nbBits], 0, 8);
+    DSD_PERF_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfCRC);
+    // divide by X^8+X^2+X+1  (100000111)
+    bool ok = m_crc8.crcbits(bits, nbBits) == FECBits::pack(&bits[nbBits], 8);
+    m_dsdDecoder->countCheck(DSDDecoder::DSDCheckDPMRCRC8, ok);
+    return ok;
+}
+
+bool DSDdPMR::decodeHamming(int nbCodewords)
+{
+    bool correctable = true;
 
-    for (int i = 0; i < nbBits; i++)
+    for (int ic = 0; ic < nbCodewords; ic++)
     {
-        if (m_bitWork[i] == 1) // divide by X^8+X^2+X+1  (100000111)
-        {
-            m_bitWork[i]    = 0; // X^8
-            m_bitWork[i+6] ^= 1; // X^2
-            m_bitWork[i+7] ^= 1; // X
-            m_bitWork[i+8] ^= 1; // 1
+        uint32_t codeword = FECBits::pack(&m_bitBufferRx[12*ic], 12);
+
+        if (m_dsdDecoder->correctFEC<Hamming_12_8>(DSDDecoder::DSDFECHamming, codeword) < 0) { // uncorrectable error: keep information bits as received
+            correctable = false;
         }
-    }
 
-    if (memcmp(&bits[nbBits], &m_bitWork[nbBits], 8) == 0) // CRC OK
-    {
-        return true;
-    }
-    else
-    {
-        return false;
+        FECBits::unpack(codeword >> 4, &m_bitBuffer[8*ic], 8);
     }
+
+    return correctable;
 }
 
 DSDdPMR::LFSRGenerator::LFSRGenerator()
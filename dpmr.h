@@ -18,6 +18,7 @@
 #define DPMR_H_
 
 #include "fec.h"
+#include "crc.h"
 
 namespace DSDcc
 {
@@ -127,6 +128,7 @@ private:
     void initInterleaveIndexes();
     bool checkCRC7(unsigned char *bits, int nbBits);
     bool checkCRC8(unsigned char *bits, int nbBits);
+    bool decodeHamming(int nbCodewords); //!< Hamming (12,8) codewords in m_bitBufferRx to data bits in m_bitBuffer
 
     DSDDecoder *m_dsdDecoder;
     DPMRState   m_state;
@@ -138,11 +140,11 @@ private:
     unsigned int  m_frameIndex;           //!< count of frames in superframes with best effort
     int  m_colourCode;                    //!< calculated colour code
     LFSRGenerator m_scramblingGenerator;
-    Hamming_12_8  m_hamming;
     unsigned char m_scrambleBits[120];
     unsigned char m_bitBufferRx[120];
     unsigned char m_bitBuffer[80];
-    unsigned char m_bitWork[80];
+    CRC m_crc7;
+    CRC m_crc8;
     unsigned int dI72[72];
     unsigned int dI120[120];
     DPMRHeaderType m_headerType;
@@ -15,9 +15,11 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <sys/time.h>
 #include "dsd_decoder.h"
+#include "mbefec.h"
 
 namespace DSDcc
 {
@@ -51,15 +53,57 @@ const unsigned char DSDDecoder::m_syncProVoiceInv[32]     = {3, 1, 3, 1, 3, 1, 1
 const unsigned char DSDDecoder::m_syncProVoiceEA[32]      = {3, 1, 1, 3, 1, 3, 1, 1, 3, 3, 1, 3, 3, 1, 1, 1, 1, 1, 3, 3, 1, 3, 1, 3, 1, 1, 3 ,1 ,1 ,1, 3 ,3};
 const unsigned char DSDDecoder::m_syncProVoiceEAInv[32]   = {1, 3, 3, 1, 3, 1, 3, 3, 1, 1, 3, 1, 1 ,3 ,3, 3, 3 ,3, 1, 1 ,3, 1, 3, 1, 3, 3, 1, 3, 3, 3, 1, 1};
 
-
-DSDDecoder::DSDDecoder() :
+const DSDDecoder::SyncPattern DSDDecoder::m_syncPatterns[DSDDecoder::DSDSyncPatternNone] = {
+    packSyncPattern(m_syncP25P1, 24),
+    packSyncPattern(m_syncP25P1Inv, 24),
+    packSyncPattern(m_syncX2TDMADataBS, 24),
+    packSyncPattern(m_syncX2TDMADataMS, 24),
+    packSyncPattern(m_syncX2TDMAVoiceBS, 24),
+    packSyncPattern(m_syncX2TDMAVoiceMS, 24),
+    packSyncPattern(m_syncYSF, 20),
+    packSyncPattern(m_syncDMRDataBS, 24),
+    packSyncPattern(m_syncDMRDataMS, 24),
+    packSyncPattern(m_syncDMRVoiceBS, 24),
+    packSyncPattern(m_syncDMRVoiceMS, 24),
+    packSyncPattern(m_syncProVoice, 32),
+    packSyncPattern(m_syncProVoiceEA, 32),
+    packSyncPattern(m_syncProVoiceInv, 32),
+    packSyncPattern(m_syncProVoiceEAInv, 32),
+    packSyncPattern(m_syncNXDNRDCHFull, 20),
+    packSyncPattern(m_syncNXDNRDCHFullInv, 20),
+    packSyncPattern(m_syncDPMRFS1, 24),
+    packSyncPattern(m_syncDStar, 24),
+    packSyncPattern(m_syncDStarInv, 24),
+    packSyncPattern(m_syncDStarHeader, 24),
+    packSyncPattern(m_syncDStarHeaderInv, 24)
+};
+
+const int DSDDecoder::m_syncPatternLengths[DSDDecoder::DSDSyncPatternNone] = {
+    24, 24,         // P25
+    24, 24, 24, 24, // X2-TDMA
+    20,             // YSF
+    24, 24, 24, 24, // DMR
+    32, 32, 32, 32, // ProVoice
+    20, 20,         // NXDN
+    24,             // dPMR
+    24, 24, 24, 24  // D-Star
+};
+
+
+DSDDecoder::DSDDecoder(DSDFilters::DSDFilterArithmetic filterArithmetic) :
         m_fsmState(DSDLookForSync),
+        m_syncMismatches(0),
+        m_syncLength(0),
         m_mbeDVReady1(false),
+        m_mbeDVReady2(false),
         m_mbelibEnable(true),
         m_mbeRate(DSDMBERateNone),
-        m_dsdSymbol(this),
+        m_dsdSymbol(this, filterArithmetic),
         m_mbeDecoder1(this),
         m_mbeDecoder2(this),
+        m_dvFrameQueue1(DSD_DVFRAME_QUEUE_SIZE),
+        m_dvFrameQueue2(DSD_DVFRAME_QUEUE_SIZE),
+        m_sampleCount(0),
         m_dsdDMR(this),
         m_dsdDstar(this),
         m_dsdYSF(this),
@@ -70,6 +114,16 @@ DSDDecoder::DSDDecoder() :
         m_lastSyncType(DSDSyncNone),
         m_signalFormat(signalFormatNone)
 {
+    m_dvFrameSeq[0] = 0;
+    m_dvFrameSeq[1] = 0;
+    m_nbDroppedDVFrames[0] = 0;
+    m_nbDroppedDVFrames[1] = 0;
+
+    for (int i = 0; i < DSDSyncPatternNone; i++) {
+        m_syncMaxMismatches[i] = 0;
+    }
+
+    memset(&m_qualityStats, 0, sizeof(m_qualityStats));
     resetFrameSync();
     noCarrier();
     m_squelchTimeoutCount = 0;
@@ -235,6 +289,39 @@ void DSDDecoder::setDecodeMode(DSDDecodeMode mode, bool on)
     }
 }
 
+
+/**
+ * Allowing mismatches lets weak signals lock faster and stay locked but increases the rate of false syncs
+ * when searching so the maximum is capped to a quarter of the pattern length.
+ */
+void DSDDecoder::setSyncMaxMismatches(DSDDecodeMode mode, int maxMismatches)
+{
+    unsigned int patterns = getSyncPatternsMask(mode);
+
+    for (int i = 0; i < DSDSyncPatternNone; i++)
+    {
+        if (patterns & (1<<i))
+        {
+            int maxAllowed = m_syncPatternLengths[i] / 4;
+            m_syncMaxMismatches[i] = maxMismatches < 0 ? 0 : maxMismatches > maxAllowed ? maxAllowed : maxMismatches;
+        }
+    }
+}
+
+int DSDDecoder::getSyncMaxMismatches(DSDDecodeMode mode) const
+{
+    unsigned int patterns = getSyncPatternsMask(mode);
+
+    for (int i = 0; i < DSDSyncPatternNone; i++)
+    {
+        if (patterns & (1<<i)) {
+            return m_syncMaxMismatches[i];
+        }
+    }
+
+    return 0;
+}
+
 void DSDDecoder::setAudioGain(float gain)
 {
     m_opts.audio_gain = gain;
@@ -340,7 +427,7 @@ void DSDDecoder::setDataRate(DSDRate dataRate)
     }
 }
 
-void DSDDecoder::run(short sample)
+inline void DSDDecoder::checkSquelchTimeout(short sample)
 {
     // mode time out if squelch has been closed for a number of samples
     if (m_fsmState != DSDLookForSync)
@@ -354,6 +441,7 @@ void DSDDecoder::run(short sample)
             else
             {
                 m_dsdLogger.log("DSDDecoder::run: squelch time out go back to sync search\n");
+                m_qualityStats.m_squelchTimeouts++;
                 resetFrameSync();
                 m_squelchTimeoutCount = 0;
             }
@@ -363,71 +451,249 @@ void DSDDecoder::run(short sample)
             m_squelchTimeoutCount = 0;
         }
     }
+}
+
+void DSDDecoder::run(short sample)
+{
+    m_sampleCount++;
+    checkSquelchTimeout(sample);
 
     if (m_dsdSymbol.pushSample(sample)) // a symbol is retrieved
     {
-        switch (m_fsmState)
+        processSymbol();
+    }
+}
+
+/**
+ * Process a whole block of samples. The matched filter is applied on chunks of the block at once then symbols
+ * are recovered and the frame FSM is run on each new symbol. Synthesized audio accumulates in the audio buffers
+ * as with run() and should be collected after each block. DV frames are queued as they are produced.
+ */
+void DSDDecoder::runBlock(const short *samples, size_t nbSamples)
+{
+    while (nbSamples > 0)
+    {
+        int chunkSize = nbSamples < DSD_BLOCK_CHUNK_SAMPLES ? nbSamples : DSD_BLOCK_CHUNK_SAMPLES;
+        m_dsdSymbol.filterBlock(samples, m_blockSamples, chunkSize);
+
+        for (int i = 0; i < chunkSize; i++)
         {
-        case DSDLookForSync:
-            m_sync = getFrameSync(); // -> -2: still looking, -1 not found, 0 and above: sync found
+            m_sampleCount++;
+            checkSquelchTimeout(samples[i]);
 
-            if (m_sync == -2) // -2 means no sync has been found at all
+            if (m_dsdSymbol.pushFilteredSample(m_blockSamples[i])) // a symbol is retrieved
             {
-                break; // still searching -> no change in FSM state
+                processSymbol();
             }
-            else if (m_sync == -1) // -1 means sync has been found but is invalid
-            {
-                m_dsdLogger.log("DSDDecoder::run: invalid sync found: %d symbol %d (%d)\n", m_sync, m_state.symbolcnt, m_dsdSymbol.getSymbol());
-                resetFrameSync(); // go back searching
-            }
-            else // good sync found
-            {
-                m_dsdLogger.log("DSDDecoder::run: good sync found: %d symbol %d (%d)\n", m_sync, m_state.symbolcnt, m_dsdSymbol.getSymbol());
-                m_fsmState = DSDSyncFound; // go to processing state next time
+        }
+
+        samples += chunkSize;
+        nbSamples -= chunkSize;
+    }
+}
+
+int DSDDecoder::popDVFrames(int slot, DSDDVFrame *frames, int maxFrames)
+{
+    if (maxFrames <= 0) {
+        return 0;
+    }
+
+    SPSCQueue<DSDDVFrame>& queue = (slot & 1) ? m_dvFrameQueue2 : m_dvFrameQueue1;
+    return queue.pop(frames, maxFrames);
+}
+
+/**
+ * Called by the frame decoders when the DV frame of a slot is complete and before it is passed to mbelib.
+ * Sets the ready flag of the slot and queues a copy of the frame.
+ */
+void DSDDecoder::pushDVFrame(int slot, int fecErrors)
+{
+    DSDDVFrame frame;
+
+    if (slot == 0)
+    {
+        memcpy(frame.m_frame, m_mbeDVFrame1, 18);
+        m_mbeDVReady1 = true;
+    }
+    else
+    {
+        memcpy(frame.m_frame, m_mbeDVFrame2, 9);
+        memset(&frame.m_frame[9], 0, 9);
+        m_mbeDVReady2 = true;
+    }
+
+    frame.m_slot = slot;
+    frame.m_mbeRate = m_mbeRate;
+    frame.m_seq = m_dvFrameSeq[slot]++;
+    frame.m_timestamp = m_sampleCount;
+    frame.m_fecErrors = fecErrors < 0 ? getAMBEC0Errors() : fecErrors;
+
+    SPSCQueue<DSDDVFrame>& queue = slot == 0 ? m_dvFrameQueue1 : m_dvFrameQueue2;
+
+    if (!queue.push(frame)) {
+        m_nbDroppedDVFrames[slot]++;
+    }
+}
+
+/**
+ * Bits corrected by the Golay(23,12) code protecting the first word (C0) of 3600 bit/s AMBE frames.
+ * The AMBE frame is de-interleaved in ambe_fr whether mbelib is enabled or not. Unknown (-1) for other rates.
+ */
+int DSDDecoder::getAMBEC0Errors() const
+{
+    if ((m_mbeRate != DSDMBERate3600x2400) && (m_mbeRate != DSDMBERate3600x2450)) {
+        return -1;
+    }
+
+    unsigned char in[23], out[23];
+
+    for (int j = 0; j < 23; j++) {
+        in[j] = ambe_fr[0][j+1];
+    }
+
+    DSD_PERF_TIMER(m_perfStats, DSDPerfStats::DSDPerfFEC);
+    return GolayMBE::mbe_golay2312(in, out);
+}
+
+int DSDDecoder::decodeAMBEGolay(unsigned char *in, unsigned char *out)
+{
+    DSD_PERF_TIMER(m_perfStats, DSDPerfStats::DSDPerfFEC);
+    int errors = GolayMBE::mbe_golay2312(in, out);
+    countFEC(DSDFECGolay, errors);
+    return errors;
+}
+
+int DSDDecoder::decodeAMBEHamming(unsigned char *in, unsigned char *out)
+{
+    DSD_PERF_TIMER(m_perfStats, DSDPerfStats::DSDPerfFEC);
+    int errors = HammingMBE::mbe_hamming1511(in, out);
+    countFEC(DSDFECHamming, errors);
+    return errors;
+}
+
+bool DSDDecoder::perfStatsEnabled()
+{
+#ifdef DSD_USE_PERF_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+DSDDecoder::DSDQualityStats DSDDecoder::getQualityStats() const
+{
+    DSDQualityStats qualityStats = m_qualityStats;
+    qualityStats.m_mbeFrames = m_mbeDecoder1.getNbFrames() + m_mbeDecoder2.getNbFrames();
+    qualityStats.m_mbeErrs = m_mbeDecoder1.getErrsTotal() + m_mbeDecoder2.getErrsTotal();
+    qualityStats.m_mbeErrs2 = m_mbeDecoder1.getErrs2Total() + m_mbeDecoder2.getErrs2Total();
+    return qualityStats;
+}
+
+void DSDDecoder::resetQualityStats()
+{
+    memset(&m_qualityStats, 0, sizeof(m_qualityStats));
+    m_mbeDecoder1.resetErrorCounts();
+    m_mbeDecoder2.resetErrorCounts();
+}
+
+DSDPerfStats::DSDPerfStage DSDDecoder::getPerfStage() const
+{
+    switch (m_fsmState)
+    {
+    case DSDprocessDMRvoice:
+    case DSDprocessDMRvoiceMS:
+    case DSDprocessDMRdata:
+    case DSDprocessDMRdataMS:
+    case DSDprocessDMRsyncOrSkip:
+    case DSDprocessDMRSkipMS:
+        return DSDPerfStats::DSDPerfDMR;
+    case DSDprocessDSTAR:
+    case DSDprocessDSTAR_HD:
+        return DSDPerfStats::DSDPerfDStar;
+    case DSDprocessYSF:
+        return DSDPerfStats::DSDPerfYSF;
+    case DSDprocessDPMR:
+        return DSDPerfStats::DSDPerfDPMR;
+    case DSDprocessNXDN:
+    case DSDprocessNXDNVoice:
+    case DSDprocessNXDNData:
+        return DSDPerfStats::DSDPerfNXDN;
+    default:
+        return DSDPerfStats::DSDPerfFrameSync; // looking for sync and frame processing initialization
+    }
+}
+
+void DSDDecoder::processSymbol()
+{
+    DSD_PERF_SAMPLED_TIMER(m_perfStats, getPerfStage());
+
+    switch (m_fsmState)
+    {
+    case DSDLookForSync:
+        m_sync = getFrameSync(); // -> -2: still looking, -1 not found, 0 and above: sync found
+
+        if (m_sync == -2) // -2 means no sync has been found at all
+        {
+            break; // still searching -> no change in FSM state
+        }
+        else if (m_sync == -1) // -1 means sync has been found but is invalid
+        {
+            m_dsdLogger.log("DSDDecoder::run: invalid sync found: %d symbol %d (%d)\n", m_sync, m_state.symbolcnt, m_dsdSymbol.getSymbol());
+            m_qualityStats.m_invalidSyncs++;
+            resetFrameSync(); // go back searching
+        }
+        else // good sync found
+        {
+            m_dsdLogger.log("DSDDecoder::run: good sync found: %d symbol %d (%d)\n", m_sync, m_state.symbolcnt, m_dsdSymbol.getSymbol());
+
+            if (m_sync < DSDSyncNone) {
+                m_qualityStats.m_syncs[m_sync]++;
             }
 
-            break; // next
-        case DSDSyncFound:
-            m_syncType  = (DSDSyncType) m_sync;
-            m_dsdLogger.log("DSDDecoder::run: before processFrameInit: symbol %d (%d)\n", m_state.symbolcnt, m_dsdSymbol.getSymbol());
-            processFrameInit();   // initiate the process of the frame which sync has been found. This will change FSM state
-            break;
-        case DSDprocessDMRvoice:
-            m_dsdDMR.processVoice();
-            break;
-        case DSDprocessDMRvoiceMS:
-            m_dsdDMR.processVoiceMS();
-            break;
-        case DSDprocessDMRdata:
-            m_dsdDMR.processData();
-            break;
-        case DSDprocessDMRdataMS:
-            m_dsdDMR.processDataMS();
-            break;
-        case DSDprocessDMRsyncOrSkip:
-            m_dsdDMR.processSyncOrSkip();
-            break;
-        case DSDprocessDMRSkipMS:
-            m_dsdDMR.processSkipMS();
-            break;
-        case DSDprocessDSTAR:
-            m_dsdDstar.process();
-            break;
-        case DSDprocessDSTAR_HD:
-            m_dsdDstar.processHD();
-            break;
-        case DSDprocessYSF:
-            m_dsdYSF.process();
-            break;
-        case DSDprocessDPMR:
-            m_dsdDPMR.process();
-            break;
-        case DSDprocessNXDN:
-            m_dsdNXDN.process();
-            break;
-        default:
-            break;
+            m_fsmState = DSDSyncFound; // go to processing state next time
         }
+
+        break; // next
+    case DSDSyncFound:
+        m_syncType  = (DSDSyncType) m_sync;
+        m_dsdLogger.log("DSDDecoder::run: before processFrameInit: symbol %d (%d)\n", m_state.symbolcnt, m_dsdSymbol.getSymbol());
+        processFrameInit();   // initiate the process of the frame which sync has been found. This will change FSM state
+        break;
+    case DSDprocessDMRvoice:
+        m_dsdDMR.processVoice();
+        break;
+    case DSDprocessDMRvoiceMS:
+        m_dsdDMR.processVoiceMS();
+        break;
+    case DSDprocessDMRdata:
+        m_dsdDMR.processData();
+        break;
+    case DSDprocessDMRdataMS:
+        m_dsdDMR.processDataMS();
+        break;
+    case DSDprocessDMRsyncOrSkip:
+        m_dsdDMR.processSyncOrSkip();
+        break;
+    case DSDprocessDMRSkipMS:
+        m_dsdDMR.processSkipMS();
+        break;
+    case DSDprocessDSTAR:
+        m_dsdDstar.process();
+        break;
+    case DSDprocessDSTAR_HD:
+        m_dsdDstar.processHD();
+        break;
+    case DSDprocessYSF:
+        m_dsdYSF.process();
+        break;
+    case DSDprocessDPMR:
+        m_dsdDPMR.process();
+        break;
+    case DSDprocessNXDN:
+        m_dsdNXDN.process();
+        break;
+    default:
+        break;
     }
 }
 
@@ -646,403 +912,318 @@ int DSDDecoder::getFrameSync()
     {
         m_dmrBurstType = DSDDMR::DSDDMRBurstNone;
 
-        if (m_opts.frame_p25p1 == 1)
+        int nbMismatches;
+        DSDSyncPattern syncPattern = matchSyncPatterns(getEnabledSyncPatterns(), nbMismatches);
+
+        if (syncPattern != DSDSyncPatternNone)
         {
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncP25P1, 24) == 0)
-            {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
+            m_syncMismatches = nbMismatches;
+            m_syncLength = m_syncPatternLengths[syncPattern];
+        }
 
-                sprintf(m_state.ftype, "+P25 Phase 1 ");
+        switch (syncPattern)
+        {
+        case DSDSyncPatternP25P1:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" +P25p1    ", m_synctest_pos + 1);
-                }
+            sprintf(m_state.ftype, "+P25 Phase 1 ");
 
-                m_lastSyncType = DSDSyncP25p1P;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncP25p1P;
-            }
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncP25P1Inv, 24) == 0)
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4, true);
+                printFrameSync(" +P25p1    ", m_synctest_pos + 1);
+            }
 
-                sprintf(m_state.ftype, "-P25 Phase 1 ");
+            m_lastSyncType = DSDSyncP25p1P;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncP25p1P;
+        case DSDSyncPatternP25P1Inv:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4, true);
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" -P25p1    ", m_synctest_pos + 1);
-                }
+            sprintf(m_state.ftype, "-P25 Phase 1 ");
 
-                m_lastSyncType = DSDSyncP25p1N;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncP25p1N;
-            }
-        }
-        if (m_opts.frame_x2tdma == 1)
-        {
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncX2TDMADataBS, 24) == 0)
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
-                m_stationType = DSDBaseStation;
+                printFrameSync(" -P25p1    ", m_synctest_pos + 1);
+            }
 
-                sprintf(m_state.ftype, "+X2-TDMAd    ");
+            m_lastSyncType = DSDSyncP25p1N;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncP25p1N;
+        case DSDSyncPatternX2TDMADataBS:
+        case DSDSyncPatternX2TDMADataMS:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
+            m_stationType = (syncPattern == DSDSyncPatternX2TDMADataBS) ? DSDBaseStation : DSDMobileStation;
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" +X2-TDMA  ", m_synctest_pos + 1);
-                }
+            sprintf(m_state.ftype, "+X2-TDMAd    ");
 
-                m_lastSyncType = DSDSyncX2TDMADataP;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncX2TDMADataP; // done
+            if (m_opts.errorbars == 1)
+            {
+                printFrameSync(" +X2-TDMA  ", m_synctest_pos + 1);
             }
 
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncX2TDMADataMS, 24) == 0)
-            {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
-                m_stationType = DSDMobileStation;
+            m_lastSyncType = DSDSyncX2TDMADataP;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncX2TDMADataP; // done
+        case DSDSyncPatternX2TDMAVoiceBS:
+        case DSDSyncPatternX2TDMAVoiceMS:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
+            m_stationType = (syncPattern == DSDSyncPatternX2TDMAVoiceBS) ? DSDBaseStation : DSDMobileStation;
 
-                sprintf(m_state.ftype, "+X2-TDMAd    ");
+            sprintf(m_state.ftype, "+X2-TDMAv    ");
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" +X2-TDMA  ", m_synctest_pos + 1);
-                }
-
-                m_lastSyncType = DSDSyncX2TDMADataP;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncX2TDMADataP; // done
-            }
-
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncX2TDMAVoiceBS, 24) == 0)
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
-                m_stationType = DSDBaseStation;
+                printFrameSync(" +X2-TDMA  ", m_synctest_pos + 1);
+            }
 
-                sprintf(m_state.ftype, "+X2-TDMAv    ");
+            m_lastSyncType = DSDSyncX2TDMAVoiceP;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncX2TDMAVoiceP; // done
+        case DSDSyncPatternYSF:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" +X2-TDMA  ", m_synctest_pos + 1);
-                }
+            sprintf(m_state.ftype, "+YSF         ");
 
-                m_lastSyncType = DSDSyncX2TDMAVoiceP;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncX2TDMAVoiceP; // done
+            if (m_opts.errorbars == 1)
+            {
+                printFrameSync("+YSF       ", m_synctest_pos + 1);
             }
 
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncX2TDMAVoiceMS, 24) == 0)
-            {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
-                m_stationType = DSDMobileStation;
+            m_lastSyncType = DSDSyncYSF;
+            m_mbeRate = DSDMBERateNone; // choice is done inside the YSF decoder between the 3 possible modes
+            return (int) DSDSyncYSF;
+        case DSDSyncPatternDMRDataBS:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-                sprintf(m_state.ftype, "+X2-TDMAv    ");
+            m_stationType = DSDBaseStation;
+            m_dmrBurstType = DSDDMR::DSDDMRBaseStation;
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" +X2-TDMA  ", m_synctest_pos + 1);
-                }
+            // data frame
+            sprintf(m_state.ftype, "+DMRd        ");
 
-                m_lastSyncType = DSDSyncX2TDMAVoiceP;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncX2TDMAVoiceP; // done
-            }
-        }
-        if (m_opts.frame_ysf == 1)
-        {
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(20), m_syncYSF, 20) == 0)
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
+                printFrameSync(" +DMRd     ",  m_synctest_pos + 1);
+            }
 
-                sprintf(m_state.ftype, "+YSF         ");
+            m_lastSyncType = DSDSyncDMRDataP;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncDMRDataP; // done
+        case DSDSyncPatternDMRDataMS:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync("+YSF       ", m_synctest_pos + 1);
-                }
+            m_stationType = DSDMobileStation;
+            m_dmrBurstType = DSDDMR::DSDDMRMobileStation;
 
-                m_lastSyncType = DSDSyncYSF;
-                m_mbeRate = DSDMBERateNone; // choice is done inside the YSF decoder between the 3 possible modes
-                return (int) DSDSyncYSF;
-            }
-        }
-        if (m_opts.frame_dmr == 1)
-        {
-        	if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDMRDataBS, 24) == 0)
-        	{
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
+            // data frame
+            sprintf(m_state.ftype, "+DMRd        ");
 
-                m_stationType = DSDBaseStation;
-                m_dmrBurstType = DSDDMR::DSDDMRBaseStation;
+            if (m_opts.errorbars == 1)
+            {
+                printFrameSync(" +DMRd     ",  m_synctest_pos + 1);
+            }
 
-				// data frame
-				sprintf(m_state.ftype, "+DMRd        ");
+            m_lastSyncType = DSDSyncDMRDataMS;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncDMRDataMS; // done
+        case DSDSyncPatternDMRVoiceBS:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-				if (m_opts.errorbars == 1)
-				{
-					printFrameSync(" +DMRd     ",  m_synctest_pos + 1);
-				}
+            m_stationType = DSDBaseStation;
+            m_dmrBurstType = DSDDMR::DSDDMRBaseStation;
 
-				m_lastSyncType = DSDSyncDMRDataP;
-				m_mbeRate = DSDMBERate3600x2450;
-				return (int) DSDSyncDMRDataP; // done
-        	}
+            // voice frame
+            sprintf(m_state.ftype, "+DMRv        ");
 
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDMRDataMS, 24) == 0)
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
+                printFrameSync(" +DMRv     ", m_synctest_pos + 1);
+            }
 
-                m_stationType = DSDMobileStation;
-                m_dmrBurstType = DSDDMR::DSDDMRMobileStation;
+            m_lastSyncType = DSDSyncDMRVoiceP;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncDMRVoiceP; // done
+        case DSDSyncPatternDMRVoiceMS:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-                // data frame
-                sprintf(m_state.ftype, "+DMRd        ");
+            m_stationType = DSDMobileStation;
+            m_dmrBurstType = DSDDMR::DSDDMRMobileStation;
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" +DMRd     ",  m_synctest_pos + 1);
-                }
+            // voice frame
+            sprintf(m_state.ftype, "+DMRv        ");
 
-                m_lastSyncType = DSDSyncDMRDataMS;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncDMRDataMS; // done
+            if (m_opts.errorbars == 1)
+            {
+                printFrameSync(" +DMRv     ", m_synctest_pos + 1);
             }
 
-        	if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDMRVoiceBS, 24) == 0)
-        	{
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
+            m_lastSyncType = DSDSyncDMRVoiceMS;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncDMRVoiceMS; // done
+        case DSDSyncPatternProVoice:
+        case DSDSyncPatternProVoiceEA:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-                m_stationType = DSDBaseStation;
-                m_dmrBurstType = DSDDMR::DSDDMRBaseStation;
+            sprintf(m_state.ftype, "+ProVoice    ");
 
-				// voice frame
-				sprintf(m_state.ftype, "+DMRv        ");
+            if (m_opts.errorbars == 1)
+            {
+                printFrameSync(" +ProVoice ", m_synctest_pos + 1);
+            }
 
-				if (m_opts.errorbars == 1)
-				{
-					printFrameSync(" +DMRv     ", m_synctest_pos + 1);
-				}
+            m_lastSyncType = DSDSyncProVoiceP;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncProVoiceP; // done
+        case DSDSyncPatternProVoiceInv:
+        case DSDSyncPatternProVoiceEAInv:
+            m_state.carrier = 1;
+            m_state.offset = m_synctest_pos;
+            m_dsdSymbol.setFSK(4, true);
 
-				m_lastSyncType = DSDSyncDMRVoiceP;
-				m_mbeRate = DSDMBERate3600x2450;
-				return (int) DSDSyncDMRVoiceP; // done
-        	}
+            sprintf(m_state.ftype, "-ProVoice    ");
 
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDMRVoiceMS, 24) == 0)
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
+                printFrameSync(" -ProVoice ",  m_synctest_pos + 1);
+            }
 
-                m_stationType = DSDMobileStation;
-                m_dmrBurstType = DSDDMR::DSDDMRMobileStation;
+            m_lastSyncType = DSDSyncProVoiceN;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncProVoiceN; // donesynctype
+        case DSDSyncPatternNXDNRDCHFull:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-                // voice frame
-                sprintf(m_state.ftype, "+DMRv        ");
+            if (m_dataRate == DSDRate2400)
+            {
+                sprintf(m_state.ftype, "+NXDN48      ");
 
                 if (m_opts.errorbars == 1)
                 {
-                    printFrameSync(" +DMRv     ", m_synctest_pos + 1);
+                    printFrameSync(" +NXDN48   ", m_synctest_pos + 1);
                 }
-
-                m_lastSyncType = DSDSyncDMRVoiceMS;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncDMRVoiceMS; // done
             }
-        }
-        if (m_opts.frame_provoice == 1)
-        {
-            if ((memcmp(m_dsdSymbol.getSyncDibitBack(32), m_syncProVoice, 32) == 0)
-             || (memcmp(m_dsdSymbol.getSyncDibitBack(32), m_syncProVoiceEA, 32) == 0))
+            else
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
-
-                sprintf(m_state.ftype, "+ProVoice    ");
+                sprintf(m_state.ftype, "+NXDN96      ");
 
                 if (m_opts.errorbars == 1)
                 {
-                    printFrameSync(" +ProVoice ", m_synctest_pos + 1);
+                    printFrameSync(" +NXDN96   ", m_synctest_pos + 1);
                 }
-
-                m_lastSyncType = DSDSyncProVoiceP;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncProVoiceP; // done
             }
-            else if ((memcmp(m_dsdSymbol.getSyncDibitBack(32), m_syncProVoiceInv, 32) == 0)
-                || (memcmp(m_dsdSymbol.getSyncDibitBack(32), m_syncProVoiceEAInv, 32) == 0))
-            {
-                m_state.carrier = 1;
-                m_state.offset = m_synctest_pos;
-                m_dsdSymbol.setFSK(4, true);
 
-                sprintf(m_state.ftype, "-ProVoice    ");
+            m_lastSyncType = DSDSyncNXDNP;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncNXDNP; // done
+        case DSDSyncPatternNXDNRDCHFullInv:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4, true);
+
+            if (m_dataRate == DSDRate2400)
+            {
+                sprintf(m_state.ftype, "-NXDN48      ");
 
                 if (m_opts.errorbars == 1)
                 {
-                    printFrameSync(" -ProVoice ",  m_synctest_pos + 1);
+                    printFrameSync(" -NXDN48   ", m_synctest_pos + 1);
                 }
-
-                m_lastSyncType = DSDSyncProVoiceN;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncProVoiceN; // donesynctype
             }
-
-        }
-        if ((m_opts.frame_nxdn96 == 1) || (m_opts.frame_nxdn48 == 1))
-        {
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(20), m_syncNXDNRDCHFull, 20) == 0)
-            {
-				m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
-
-                if (m_dataRate == DSDRate2400)
-				{
-					sprintf(m_state.ftype, "+NXDN48      ");
-
-					if (m_opts.errorbars == 1)
-					{
-						printFrameSync(" +NXDN48   ", m_synctest_pos + 1);
-					}
-				}
-				else
-				{
-					sprintf(m_state.ftype, "+NXDN96      ");
-
-					if (m_opts.errorbars == 1)
-					{
-						printFrameSync(" +NXDN96   ", m_synctest_pos + 1);
-					}
-				}
-
-				m_lastSyncType = DSDSyncNXDNP;
-				m_mbeRate = DSDMBERate3600x2450;
-				return (int) DSDSyncNXDNP; // done
-            }
-            else if (memcmp(m_dsdSymbol.getSyncDibitBack(20), m_syncNXDNRDCHFullInv, 20) == 0)
-            {
-				m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4, true);
-
-                if (m_dataRate == DSDRate2400)
-				{
-					sprintf(m_state.ftype, "-NXDN48      ");
-
-					if (m_opts.errorbars == 1)
-					{
-						printFrameSync(" -NXDN48   ", m_synctest_pos + 1);
-					}
-				}
-				else
-				{
-					sprintf(m_state.ftype, "-NXDN96      ");
-
-					if (m_opts.errorbars == 1)
-					{
-						printFrameSync(" -NXDN96   ", m_synctest_pos + 1);
-					}
-				}
-
-                m_lastSyncType = DSDSyncNXDNN;
-				m_mbeRate = DSDMBERate3600x2450;
-				return (int) DSDSyncNXDNN; // done
-            }
-        }
-        if (m_opts.frame_dpmr == 1)
-        {
-            if(memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDPMRFS1, 24) == 0) // dPMR classic (not packet)
+            else
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(4);
-
-                sprintf(m_state.ftype, "+dPMR        ");
+                sprintf(m_state.ftype, "-NXDN96      ");
 
                 if (m_opts.errorbars == 1)
                 {
-                    printFrameSync("+dPMR      ", m_synctest_pos + 1);
+                    printFrameSync(" -NXDN96   ", m_synctest_pos + 1);
                 }
-
-                m_lastSyncType = DSDSyncDPMR;
-                m_mbeRate = DSDMBERate3600x2450;
-                return (int) DSDSyncDPMR;
             }
-        }
-        if (m_opts.frame_dstar == 1)
-        {
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDStar, 24) == 0)
-            {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(2);
 
-                sprintf(m_state.ftype, "+D-STAR      ");
+            m_lastSyncType = DSDSyncNXDNN;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncNXDNN; // done
+        case DSDSyncPatternDPMRFS1: // dPMR classic (not packet)
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(4);
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" +D-STAR   ",  m_synctest_pos + 1);
-                }
+            sprintf(m_state.ftype, "+dPMR        ");
 
-                m_lastSyncType = DSDSyncDStarP;
-                m_mbeRate = DSDMBERate3600x2400;
-                return (int) DSDSyncDStarP;
-            }
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDStarInv, 24) == 0)
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(2, true);
+                printFrameSync("+dPMR      ", m_synctest_pos + 1);
+            }
 
-                sprintf(m_state.ftype, "-D-STAR      ");
+            m_lastSyncType = DSDSyncDPMR;
+            m_mbeRate = DSDMBERate3600x2450;
+            return (int) DSDSyncDPMR;
+        case DSDSyncPatternDStar:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(2);
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" -D-STAR   ", m_synctest_pos + 1);
-                }
+            sprintf(m_state.ftype, "+D-STAR      ");
 
-                m_lastSyncType = DSDSyncDStarN;
-                m_mbeRate = DSDMBERate3600x2400;
-                return (int) DSDSyncDStarN; // done
-            }
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDStarHeader, 24) == 0)
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(2);
+                printFrameSync(" +D-STAR   ",  m_synctest_pos + 1);
+            }
 
-                sprintf(m_state.ftype, "+D-STAR_HD   ");
+            m_lastSyncType = DSDSyncDStarP;
+            m_mbeRate = DSDMBERate3600x2400;
+            return (int) DSDSyncDStarP;
+        case DSDSyncPatternDStarInv:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(2, true);
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" +D-STAR_HD   ", m_synctest_pos + 1);
-                }
+            sprintf(m_state.ftype, "-D-STAR      ");
 
-                m_lastSyncType = DSDSyncDStarHeaderP;
-                m_mbeRate = DSDMBERate3600x2400;
-                return (int) DSDSyncDStarHeaderP; // done
+            if (m_opts.errorbars == 1)
+            {
+                printFrameSync(" -D-STAR   ", m_synctest_pos + 1);
             }
-            if (memcmp(m_dsdSymbol.getSyncDibitBack(24), m_syncDStarHeaderInv, 24) == 0)
+
+            m_lastSyncType = DSDSyncDStarN;
+            m_mbeRate = DSDMBERate3600x2400;
+            return (int) DSDSyncDStarN; // done
+        case DSDSyncPatternDStarHeader:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(2);
+
+            sprintf(m_state.ftype, "+D-STAR_HD   ");
+
+            if (m_opts.errorbars == 1)
             {
-                m_state.carrier = 1;
-                m_dsdSymbol.setFSK(2, true);
+                printFrameSync(" +D-STAR_HD   ", m_synctest_pos + 1);
+            }
 
-                sprintf(m_state.ftype, "-D-STAR_HD   ");
+            m_lastSyncType = DSDSyncDStarHeaderP;
+            m_mbeRate = DSDMBERate3600x2400;
+            return (int) DSDSyncDStarHeaderP; // done
+        case DSDSyncPatternDStarHeaderInv:
+            m_state.carrier = 1;
+            m_dsdSymbol.setFSK(2, true);
 
-                if (m_opts.errorbars == 1)
-                {
-                    printFrameSync(" -D-STAR_HD   ", m_synctest_pos + 1);
-                }
+            sprintf(m_state.ftype, "-D-STAR_HD   ");
 
-                m_lastSyncType = DSDSyncDStarHeaderN;
-                m_mbeRate = DSDMBERate3600x2400;
-                return (int) DSDSyncDStarHeaderN;
+            if (m_opts.errorbars == 1)
+            {
+                printFrameSync(" -D-STAR_HD   ", m_synctest_pos + 1);
             }
+
+            m_lastSyncType = DSDSyncDStarHeaderN;
+            m_mbeRate = DSDMBERate3600x2400;
+            return (int) DSDSyncDStarHeaderN;
+        default:
+            break;
         }
     }
 
@@ -1064,6 +1245,151 @@ int DSDDecoder::getFrameSync()
     return -2; // still searching
 }
 
+DSDDecoder::SyncPattern DSDDecoder::packSyncPattern(const unsigned char *sync, int length)
+{
+    SyncPattern syncPattern;
+    syncPattern.m_pattern = 0;
+    syncPattern.m_mask = 0;
+
+    for (int i = 0; i < length; i++) // first symbol ends up in the highest bit
+    {
+        syncPattern.m_pattern = (syncPattern.m_pattern << 1) | (sync[i] == 3 ? 1 : 0);
+        syncPattern.m_mask = (syncPattern.m_mask << 1) | 1;
+    }
+
+    return syncPattern;
+}
+
+int DSDDecoder::countBits(uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    int nbBits = 0;
+
+    for (; x; nbBits++) {
+        x &= x - 1;
+    }
+
+    return nbBits;
+#endif
+}
+
+unsigned int DSDDecoder::getSyncPatternsMask(DSDDecodeMode mode)
+{
+    switch (mode)
+    {
+    case DSDDecodeAuto:
+        return (1<<DSDSyncPatternNone) - 1;
+    case DSDDecodeP25P1:
+        return (1<<DSDSyncPatternP25P1) | (1<<DSDSyncPatternP25P1Inv);
+    case DSDDecodeX2TDMA:
+        return (1<<DSDSyncPatternX2TDMADataBS) | (1<<DSDSyncPatternX2TDMADataMS)
+            | (1<<DSDSyncPatternX2TDMAVoiceBS) | (1<<DSDSyncPatternX2TDMAVoiceMS);
+    case DSDDecodeYSF:
+        return (1<<DSDSyncPatternYSF);
+    case DSDDecodeDMR:
+        return (1<<DSDSyncPatternDMRDataBS) | (1<<DSDSyncPatternDMRDataMS)
+            | (1<<DSDSyncPatternDMRVoiceBS) | (1<<DSDSyncPatternDMRVoiceMS);
+    case DSDDecodeProVoice:
+        return (1<<DSDSyncPatternProVoice) | (1<<DSDSyncPatternProVoiceEA)
+            | (1<<DSDSyncPatternProVoiceInv) | (1<<DSDSyncPatternProVoiceEAInv);
+    case DSDDecodeNXDN48:
+    case DSDDecodeNXDN96:
+        return (1<<DSDSyncPatternNXDNRDCHFull) | (1<<DSDSyncPatternNXDNRDCHFullInv);
+    case DSDDecodeDPMR:
+        return (1<<DSDSyncPatternDPMRFS1);
+    case DSDDecodeDStar:
+        return (1<<DSDSyncPatternDStar) | (1<<DSDSyncPatternDStarInv)
+            | (1<<DSDSyncPatternDStarHeader) | (1<<DSDSyncPatternDStarHeaderInv);
+    default:
+        return 0;
+    }
+}
+
+unsigned int DSDDecoder::getEnabledSyncPatterns() const
+{
+    unsigned int enabledPatterns = 0;
+
+    if (m_opts.frame_p25p1 == 1) {
+        enabledPatterns |= getSyncPatternsMask(DSDDecodeP25P1);
+    }
+    if (m_opts.frame_x2tdma == 1) {
+        enabledPatterns |= getSyncPatternsMask(DSDDecodeX2TDMA);
+    }
+    if (m_opts.frame_ysf == 1) {
+        enabledPatterns |= getSyncPatternsMask(DSDDecodeYSF);
+    }
+    if (m_opts.frame_dmr == 1) {
+        enabledPatterns |= getSyncPatternsMask(DSDDecodeDMR);
+    }
+    if (m_opts.frame_provoice == 1) {
+        enabledPatterns |= getSyncPatternsMask(DSDDecodeProVoice);
+    }
+    if ((m_opts.frame_nxdn96 == 1) || (m_opts.frame_nxdn48 == 1)) {
+        enabledPatterns |= getSyncPatternsMask(DSDDecodeNXDN96);
+    }
+    if (m_opts.frame_dpmr == 1) {
+        enabledPatterns |= getSyncPatternsMask(DSDDecodeDPMR);
+    }
+    if (m_opts.frame_dstar == 1) {
+        enabledPatterns |= getSyncPatternsMask(DSDDecodeDStar);
+    }
+
+    return enabledPatterns;
+}
+
+int DSDDecoder::getSyncPatternMismatches(DSDSyncPattern syncPattern) const
+{
+    if ((m_syncPatterns[syncPattern].m_mask & ~m_dsdSymbol.getSyncRegisterValid()) != 0) {
+        return -1;
+    }
+
+    return countBits((m_dsdSymbol.getSyncRegister() ^ m_syncPatterns[syncPattern].m_pattern) & m_syncPatterns[syncPattern].m_mask);
+}
+
+bool DSDDecoder::isSyncPattern(DSDSyncPattern syncPattern) const
+{
+    int nbMismatches = getSyncPatternMismatches(syncPattern);
+    return (nbMismatches >= 0) && (nbMismatches <= m_syncMaxMismatches[syncPattern]);
+}
+
+/**
+ * Compares the last sync symbols with all enabled patterns in one pass. A symbol mismatch is a bit set
+ * in the XOR of the sync register and the pattern. Returns the pattern with the least mismatches within
+ * its allowed maximum and the first one in order of priority in case of a tie.
+ */
+DSDDecoder::DSDSyncPattern DSDDecoder::matchSyncPatterns(unsigned int enabledPatterns, int& nbMismatches) const
+{
+    DSDSyncPattern bestPattern = DSDSyncPatternNone;
+    nbMismatches = 0;
+
+    for (int i = 0; i < DSDSyncPatternNone; i++)
+    {
+        if ((enabledPatterns & (1<<i)) == 0) {
+            continue;
+        }
+
+        int patternMismatches = getSyncPatternMismatches((DSDSyncPattern) i);
+
+        if ((patternMismatches < 0) || (patternMismatches > m_syncMaxMismatches[i])) {
+            continue;
+        }
+
+        if ((bestPattern == DSDSyncPatternNone) || (patternMismatches < nbMismatches))
+        {
+            bestPattern = (DSDSyncPattern) i;
+            nbMismatches = patternMismatches;
+
+            if (nbMismatches == 0) { // cannot do better
+                break;
+            }
+        }
+    }
+
+    return bestPattern;
+}
+
 void DSDDecoder::resetFrameSync()
 {
     m_dsdLogger.log("DSDDecoder::resetFrameSync: symbol %d (%d)\n", m_state.symbolcnt, m_dsdSymbol.getSymbol());
@@ -1073,6 +1399,8 @@ void DSDDecoder::resetFrameSync()
     m_synctest_pos = 0;
 
     m_sync = -2;   // mark in progress
+    m_syncMismatches = 0;
+    m_syncLength = 0; // no sync score until the next frame sync
 
     if ((m_opts.symboltiming == 1) && (m_state.carrier == 1))
     {
@@ -1101,6 +1429,8 @@ void DSDDecoder::noCarrier()
     m_stationType = DSDStationTypeNotApplicable;
     m_lastSyncType = DSDSyncNone;
     m_state.carrier = 0;
+    m_syncMismatches = 0;
+    m_syncLength = 0;
 
     sprintf(m_state.slot0light, "                          ");
     sprintf(m_state.slot1light, "                          ");
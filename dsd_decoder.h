@@ -17,6 +17,8 @@
 #ifndef DSDCC_DSD_DECODER_H_
 #define DSDCC_DSD_DECODER_H_
 
+#include <stddef.h>
+
 #include "dsd_opts.h"
 #include "dsd_state.h"
 #include "dsd_logger.h"
@@ -28,8 +30,13 @@
 #include "dstar.h"
 #include "nxdn.h"
 #include "locator.h"
+#include "spscqueue.h"
+#include "dsd_perf.h"
 
 #define DSD_SQUELCH_TIMEOUT_SAMPLES 960 // 200ms timeout after return to sync search
+#define DSD_BLOCK_CHUNK_SAMPLES 1024  // number of samples matched filtered at once in block processing
+#define DSD_DVFRAME_QUEUE_SIZE 64     // DV frames queued per slot (~1.2s of voice)
+#define DSD_DECODER_SIZE_TARGET 40960 // maximum sizeof(DSDDecoder) for many channel deployments. Checked by testfec/footprint
 
 namespace DSDcc
 {
@@ -148,14 +155,68 @@ public:
         DSDMBERate4400
     } DSDMBERate;
 
-    DSDDecoder();
+    struct DSDDVFrame
+    {
+        unsigned char m_frame[18]; //!< AMBE/IMBE encoded frame
+        int m_slot;                //!< 0: TDMA unique or first slot, 1: TDMA second slot
+        DSDMBERate m_mbeRate;      //!< rate of the encoded frame
+        unsigned int m_seq;        //!< sequence number in the slot. A gap shows dropped frames
+        uint64_t m_timestamp;      //!< index of the input sample that completed the frame
+        int m_fecErrors;           //!< bits corrected by the AMBE/IMBE FEC, -1 if not known
+    };
+
+    typedef enum
+    {
+        DSDFECGolay,   //!< DMR slot type, YSF FICH and AMBE Golay (23,12)
+        DSDFECHamming, //!< DMR CACH and embedded signalling, dPMR and AMBE Hamming (15,11)
+        DSDFECQR,      //!< DMR EMB
+        DSDFECNbCodes
+    } DSDFECCode;
+
+    typedef enum
+    {
+        DSDCheckYSFCRC16,
+        DSDCheckDStarHeaderCRC, //!< radio header and header sent in the slow data
+        DSDCheckDPMRCRC7,
+        DSDCheckDPMRCRC8,
+        DSDCheckDMRSlotType,    //!< Golay (20,8) decoding of the slot type
+        DSDNbChecks
+    } DSDCheck;
+
+    /** Decode quality counters. Compare them between two snapshots to get rates */
+    struct DSDQualityStats
+    {
+        unsigned int m_syncs[DSDSyncNone];              //!< frame syncs found per sync type
+        unsigned int m_invalidSyncs;                    //!< sync patterns found that the enabled modes do not accept
+        unsigned int m_fecCodewords[DSDFECNbCodes];     //!< codewords decoded
+        unsigned int m_fecCorrectedBits[DSDFECNbCodes]; //!< bits corrected in the correctable codewords
+        unsigned int m_fecUncorrectable[DSDFECNbCodes]; //!< codewords with more errors than the code can correct
+        unsigned int m_checksOK[DSDNbChecks];
+        unsigned int m_checksKO[DSDNbChecks];
+        unsigned int m_mbeFrames;                       //!< frames synthesized by mbelib
+        unsigned int m_mbeErrs;                         //!< total of the errors reported by mbelib
+        unsigned int m_mbeErrs2;                        //!< total of the second error count reported by mbelib
+        unsigned int m_squelchTimeouts;                 //!< returns to sync search because the squelch stayed closed
+    };
+
+    DSDDecoder(DSDFilters::DSDFilterArithmetic filterArithmetic = DSDFilters::DSDFilterFloat); //!< filters arithmetic is fixed for the life of the decoder
     ~DSDDecoder();
 
     void run(short sample);
+    void runBlock(const short *samples, size_t nbSamples); //!< process a block of samples. Results are collected for the whole block
+
+    /**
+     * DV frames are queued per slot as they are produced whether samples are pushed one by one or by blocks.
+     * Pop them regularly: when a queue is full new frames are dropped and counted. The queues can be popped
+     * from another thread than the one running the decoder.
+     */
+    int popDVFrames(int slot, DSDDVFrame *frames, int maxFrames); //!< pops up to maxFrames frames of the slot (0 or 1) in order. Returns the number of frames
+    unsigned int getNbDroppedDVFrames(int slot) const { return m_nbDroppedDVFrames[slot & 1]; }
+
     short getFilteredSample() const { return m_dsdSymbol.getFilteredSample(); }
     short getSymbolSyncSample() const { return m_dsdSymbol.getSymbolSyncSample(); }
 
-    /** DVSI support */
+    /** DVSI support. Last frame of each slot only. See popDVFrames to get all frames */
 
     const unsigned char *getMbeDVFrame1() const {
         return m_mbeDVFrame1;
@@ -203,6 +264,39 @@ public:
         m_mbeDecoder2.resetAudio();
     }
 
+    /** Audio buffers capacity in samples per channel (default 48000). Both buffers are allocated on first use */
+    void setAudioBufferSize(int nbSamples)
+    {
+        m_mbeDecoder1.setAudioBufferSize(nbSamples);
+        m_mbeDecoder2.setAudioBufferSize(nbSamples);
+    }
+
+    /**
+     * Asynchronous MBE synthesis: the decoder only queues the AMBE/IMBE frames and audio is produced
+     * by synthesizeAudio. This can be called from another thread than the one running the decoder
+     * but then getAudio1/2 and resetAudio1/2 must be called from that same thread.
+     * Set it before running the decoder.
+     */
+    void enableMbeAsync(bool enable)
+    {
+        m_mbeDecoder1.setAsync(enable);
+        m_mbeDecoder2.setAsync(enable);
+    }
+
+    bool isMbeAsync() const { return m_mbeDecoder1.getAsync(); }
+
+    /** Synthesize audio from the queued frames of both slots. Returns the number of frames synthesized */
+    int synthesizeAudio()
+    {
+        return m_mbeDecoder1.synthesizeQueued() + m_mbeDecoder2.synthesizeQueued();
+    }
+
+    /** Number of frames lost because the synthesis did not keep up */
+    unsigned int getMbeDroppedFrames() const
+    {
+        return m_mbeDecoder1.getNbDroppedFrames() + m_mbeDecoder2.getNbDroppedFrames();
+    }
+
     //DSDOpts *getOpts() { return &m_opts; }
     //DSDState *getState() { return &m_state; }
 
@@ -222,6 +316,12 @@ public:
     int getCarrierPos() const { return m_dsdSymbol.getCarrierPos(); }
     int getZeroCrossingPos() const { return m_dsdSymbol.getZeroCrossingPos(); }
     int getSymbolSyncQuality() const { return m_dsdSymbol.getSymbolSyncQuality(); }
+
+    int getSyncMismatches() const { return m_syncMismatches; } //!< symbols that differed from the sync pattern of the frame being processed
+    float getSyncScore() const //!< correlation with the sync pattern of the frame being processed: 1.0 for an exact match, 0.0 while looking for sync
+    {
+        return m_syncLength == 0 ? 0.0f : (m_syncLength - 2*m_syncMismatches) / (float) m_syncLength;
+    }
     int getSamplesPerSymbol() const { return m_dsdSymbol.getSamplesPerSymbol(); }
     DSDRate getDataRate() const { return m_dataRate; };
     bool getVoice1On() const { return m_voice1On; }
@@ -233,6 +333,16 @@ public:
     const DSDDstar& getDStarDecoder() const { return m_dsdDstar; }
     const DSDdPMR& getDPMRDecoder() const { return m_dsdDPMR; }
     const DSDYSF& getYSFDecoder() const { return m_dsdYSF; }
+
+    /** Time and calls of the decoding stages since creation or last reset. All zero unless compiled with DSD_USE_PERF_STATS */
+    DSDPerfStats getPerfStats() const { return m_perfStats; }
+    void resetPerfStats() { m_perfStats.reset(); }
+    static bool perfStatsEnabled(); //!< true if the library was compiled with DSD_USE_PERF_STATS
+
+    /** Decode quality counters since creation or last reset. The mbelib ones stay at zero when mbelib is disabled */
+    DSDQualityStats getQualityStats() const;
+    void resetQualityStats();
+
     void enableMbelib(bool enable) { m_mbelibEnable = enable; }
 
     // Initializations:
@@ -243,6 +353,8 @@ public:
     void setP25DisplayOptions(DSDShowP25 mode, bool on);
     void muteEncryptedP25(bool on);
     void setDecodeMode(DSDDecodeMode mode, bool on);
+    void setSyncMaxMismatches(DSDDecodeMode mode, int maxMismatches); //!< sync symbols allowed to differ from the pattern (default 0). DSDDecodeAuto sets all
+    int getSyncMaxMismatches(DSDDecodeMode mode) const;
     void setAudioGain(float gain);
     void setUvQuality(int uvquality);
     void setUpsampling(int upsampling);
@@ -252,6 +364,7 @@ public:
     void enableAudioOut(bool on);
     void enableScanResumeAfterTDULCFrames(int nbFrames);
     void setDataRate(DSDRate dataRate);
+    void setLevelTracking(DSDSymbol::DSDLevelTracking levelTracking) { m_dsdSymbol.setLevelTracking(levelTracking); } //!< symbol decision thresholds method (default min/max)
     void setMyPoint(float lat, float lon) { m_myPoint.setLatLon(lat, lon); }
 
     // parameter getters:
@@ -303,12 +416,105 @@ private:
         signalFormatYSF
     } SignalFormat;
 
+    /** Sync patterns looked for by getFrameSync in this order of priority */
+    typedef enum
+    {
+        DSDSyncPatternP25P1,
+        DSDSyncPatternP25P1Inv,
+        DSDSyncPatternX2TDMADataBS,
+        DSDSyncPatternX2TDMADataMS,
+        DSDSyncPatternX2TDMAVoiceBS,
+        DSDSyncPatternX2TDMAVoiceMS,
+        DSDSyncPatternYSF,
+        DSDSyncPatternDMRDataBS,
+        DSDSyncPatternDMRDataMS,
+        DSDSyncPatternDMRVoiceBS,
+        DSDSyncPatternDMRVoiceMS,
+        DSDSyncPatternProVoice,
+        DSDSyncPatternProVoiceEA,
+        DSDSyncPatternProVoiceInv,
+        DSDSyncPatternProVoiceEAInv,
+        DSDSyncPatternNXDNRDCHFull,
+        DSDSyncPatternNXDNRDCHFullInv,
+        DSDSyncPatternDPMRFS1,
+        DSDSyncPatternDStar,
+        DSDSyncPatternDStarInv,
+        DSDSyncPatternDStarHeader,
+        DSDSyncPatternDStarHeaderInv,
+        DSDSyncPatternNone //!< also the number of patterns
+    } DSDSyncPattern;
+
+    struct SyncPattern
+    {
+        uint64_t m_pattern; //!< packed like the symbol sync register
+        uint64_t m_mask;    //!< one bit set per symbol of the pattern
+    };
+
+    static SyncPattern packSyncPattern(const unsigned char *sync, int length);
+    static int countBits(uint64_t x);
+    static unsigned int getSyncPatternsMask(DSDDecodeMode mode); //!< patterns of a protocol one bit per DSDSyncPattern
+    unsigned int getEnabledSyncPatterns() const;
+    DSDSyncPattern matchSyncPatterns(unsigned int enabledPatterns, int& nbMismatches) const;
+    int getSyncPatternMismatches(DSDSyncPattern syncPattern) const; //!< mismatches with the last sync symbols, -1 if not enough symbols yet
+    bool isSyncPattern(DSDSyncPattern syncPattern) const; //!< last sync symbols match the pattern within its maximum mismatches
+
+    void checkSquelchTimeout(short sample);
+    void processSymbol();
+    void pushDVFrame(int slot, int fecErrors = -1);
+    int getAMBEC0Errors() const;
     int getFrameSync();
     void resetFrameSync();
     void printFrameSync(const char *frametype, int offset);
     void noCarrier();
     void printFrameInfo();
     void processFrameInit();
+    DSDPerfStats::DSDPerfStage getPerfStage() const; //!< stage of the current FSM state
+
+    void countFEC(DSDFECCode code, int errors) //!< errors as returned by the FEC decoders: bits corrected or -1 if not correctable
+    {
+        m_qualityStats.m_fecCodewords[code]++;
+
+        if (errors < 0) {
+            m_qualityStats.m_fecUncorrectable[code]++;
+        } else {
+            m_qualityStats.m_fecCorrectedBits[code] += errors;
+        }
+    }
+
+    /** FEC and Viterbi decoding for the protocol decoders. Timed in the perf stats and counted in the quality stats */
+    template<typename Code> int decodeFEC(DSDFECCode fecCode, uint32_t codeword, uint32_t& data)
+    {
+        DSD_PERF_TIMER(m_perfStats, DSDPerfStats::DSDPerfFEC);
+        int errors = Code::decodeWord(codeword, data);
+        countFEC(fecCode, errors);
+        return errors;
+    }
+
+    template<typename Code> int correctFEC(DSDFECCode fecCode, uint32_t& codeword)
+    {
+        DSD_PERF_TIMER(m_perfStats, DSDPerfStats::DSDPerfFEC);
+        int errors = Code::correctWord(codeword);
+        countFEC(fecCode, errors);
+        return errors;
+    }
+
+    int decodeAMBEGolay(unsigned char *in, unsigned char *out);   //!< Golay (23,12) of AMBE frames
+    int decodeAMBEHamming(unsigned char *in, unsigned char *out); //!< Hamming (15,11) of AMBE frames
+
+    void decodeViterbi(Viterbi& viterbi, unsigned char *dataBits, const unsigned char *softBits, unsigned int nbBits)
+    {
+        DSD_PERF_TIMER(m_perfStats, DSDPerfStats::DSDPerfViterbi);
+        viterbi.decodeFromSoftBits(dataBits, softBits, nbBits, 0, DSD_SOFT_BIT_MAX);
+    }
+
+    void countCheck(DSDCheck check, bool ok)
+    {
+        if (ok) {
+            m_qualityStats.m_checksOK[check]++;
+        } else {
+            m_qualityStats.m_checksKO[check]++;
+        }
+    }
     static int comp(const void *a, const void *b);
 
     DSDOpts m_opts;
@@ -320,6 +526,11 @@ private:
     // sync engine:
     int m_sync; //!< The current internal sync type
     int m_dibit, m_synctest_pos;
+    static const SyncPattern m_syncPatterns[DSDSyncPatternNone]; //!< packed versions of the frame sync patterns
+    static const int m_syncPatternLengths[DSDSyncPatternNone];
+    int m_syncMaxMismatches[DSDSyncPatternNone]; //!< symbols allowed to differ for a pattern to be recognized
+    int m_syncMismatches; //!< symbols that differed at last frame sync
+    int m_syncLength;     //!< length of the last frame sync pattern found
     int m_lsum;
     char m_spectrum[64];
     int m_t;
@@ -338,6 +549,13 @@ private:
     bool m_mbeDVReady1;              //!< AMBE/IMBE encoded frame ready status for TDMA unique or first slot
     unsigned char m_mbeDVFrame2[9];  //!< AMBE encoded frame for TDMA second slot
     bool m_mbeDVReady2;              //!< AMBE encoded frame ready status for TDMA second slot
+    SPSCQueue<DSDDVFrame> m_dvFrameQueue1; //!< DV frames of TDMA unique or first slot
+    SPSCQueue<DSDDVFrame> m_dvFrameQueue2; //!< DV frames of TDMA second slot
+    unsigned int m_dvFrameSeq[2];          //!< next sequence number per slot
+    unsigned int m_nbDroppedDVFrames[2];
+    uint64_t m_sampleCount;                //!< input samples since the decoder was created
+    mutable DSDPerfStats m_perfStats;      //!< updated from const methods too
+    DSDQualityStats m_qualityStats;        //!< mbelib counters are kept by the MBE decoders
     // Voice announcements
     bool m_voice1On;
     bool m_voice2On;
@@ -353,6 +571,8 @@ private:
     LocPoint m_myPoint;
     // status text
     SignalFormat m_signalFormat;
+    // block processing
+    short m_blockSamples[DSD_BLOCK_CHUNK_SAMPLES];           //!< matched filter output of the current chunk
 };
 
 } // namespace dsdcc
@@ -0,0 +1,231 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "dsd_decoder_pool.h"
+
+namespace DSDcc
+{
+
+DSDDecoderPool::DSDDecoderPool(int nbChannels, int nbThreads, DSDFilters::DSDFilterArithmetic filterArithmetic) :
+        m_nbChannels(nbChannels < 1 ? 1 : nbChannels),
+        m_channelBuffers(0),
+        m_channelBufferSize(0),
+        m_nbWorkers(0),
+        m_workers(0),
+        m_generation(0),
+        m_nextChannel(0),
+        m_nbChannelsDone(0),
+        m_stop(false)
+{
+    m_decoders = new DSDDecoder*[m_nbChannels];
+    m_blockSamples = new const short*[m_nbChannels];
+    m_blockNbSamples = new int[m_nbChannels];
+
+    for (int i = 0; i < m_nbChannels; i++)
+    {
+        m_decoders[i] = new DSDDecoder(filterArithmetic);
+        m_blockSamples[i] = 0;
+        m_blockNbSamples[i] = 0;
+    }
+
+    pthread_mutex_init(&m_mutex, 0);
+    pthread_cond_init(&m_startCond, 0);
+    pthread_cond_init(&m_doneCond, 0);
+
+    if (nbThreads > m_nbChannels) { // more threads would stay idle
+        nbThreads = m_nbChannels;
+    }
+
+    if (nbThreads > 1)
+    {
+        m_workers = new pthread_t[nbThreads - 1];
+
+        for (int i = 0; i < nbThreads - 1; i++)
+        {
+            if (pthread_create(&m_workers[m_nbWorkers], 0, workerThread, this) == 0) {
+                m_nbWorkers++;
+            }
+        }
+    }
+}
+
+DSDDecoderPool::~DSDDecoderPool()
+{
+    pthread_mutex_lock(&m_mutex);
+    m_stop = true;
+    pthread_cond_broadcast(&m_startCond);
+    pthread_mutex_unlock(&m_mutex);
+
+    for (int i = 0; i < m_nbWorkers; i++) {
+        pthread_join(m_workers[i], 0);
+    }
+
+    if (m_workers) {
+        delete[] m_workers;
+    }
+
+    pthread_cond_destroy(&m_doneCond);
+    pthread_cond_destroy(&m_startCond);
+    pthread_mutex_destroy(&m_mutex);
+
+    for (int i = 0; i < m_nbChannels; i++)
+    {
+        delete m_decoders[i];
+
+        if (m_channelBuffers) {
+            delete[] m_channelBuffers[i];
+        }
+    }
+
+    if (m_channelBuffers) {
+        delete[] m_channelBuffers;
+    }
+
+    delete[] m_blockNbSamples;
+    delete[] m_blockSamples;
+    delete[] m_decoders;
+}
+
+void DSDDecoderPool::runBlocks(const short * const *samples, const int *nbSamples)
+{
+    for (int i = 0; i < m_nbChannels; i++)
+    {
+        m_blockSamples[i] = samples[i];
+        m_blockNbSamples[i] = nbSamples[i];
+    }
+
+    if (m_nbWorkers == 0)
+    {
+        for (int i = 0; i < m_nbChannels; i++) {
+            m_decoders[i]->runBlock(m_blockSamples[i], m_blockNbSamples[i]);
+        }
+
+        return;
+    }
+
+    pthread_mutex_lock(&m_mutex);
+    m_nextChannel = 0;
+    m_nbChannelsDone = 0;
+    m_generation++;
+    pthread_cond_broadcast(&m_startCond);
+    pthread_mutex_unlock(&m_mutex);
+
+    processChannels(); // the calling thread takes its share
+
+    pthread_mutex_lock(&m_mutex);
+
+    while (m_nbChannelsDone < m_nbChannels) {
+        pthread_cond_wait(&m_doneCond, &m_mutex);
+    }
+
+    pthread_mutex_unlock(&m_mutex);
+}
+
+void DSDDecoderPool::runInterleaved(const short *samples, int nbFrames)
+{
+    if (m_nbChannels == 1) // nothing to de-interleave
+    {
+        runBlocks(&samples, &nbFrames);
+        return;
+    }
+
+    if (nbFrames > m_channelBufferSize)
+    {
+        if (m_channelBuffers)
+        {
+            for (int i = 0; i < m_nbChannels; i++) {
+                delete[] m_channelBuffers[i];
+            }
+        }
+        else
+        {
+            m_channelBuffers = new short*[m_nbChannels];
+        }
+
+        for (int i = 0; i < m_nbChannels; i++) {
+            m_channelBuffers[i] = new short[nbFrames];
+        }
+
+        m_channelBufferSize = nbFrames;
+    }
+
+    for (int i = 0; i < nbFrames; i++)
+    {
+        for (int j = 0; j < m_nbChannels; j++) {
+            m_channelBuffers[j][i] = samples[i*m_nbChannels + j];
+        }
+    }
+
+    for (int j = 0; j < m_nbChannels; j++) {
+        m_blockNbSamples[j] = nbFrames;
+    }
+
+    runBlocks(m_channelBuffers, m_blockNbSamples);
+}
+
+void *DSDDecoderPool::workerThread(void *arg)
+{
+    ((DSDDecoderPool *) arg)->workerLoop();
+    return 0;
+}
+
+void DSDDecoderPool::workerLoop()
+{
+    unsigned int generation = 0;
+
+    while (true)
+    {
+        pthread_mutex_lock(&m_mutex);
+
+        while (!m_stop && (m_generation == generation)) {
+            pthread_cond_wait(&m_startCond, &m_mutex);
+        }
+
+        if (m_stop)
+        {
+            pthread_mutex_unlock(&m_mutex);
+            return;
+        }
+
+        generation = m_generation;
+        pthread_mutex_unlock(&m_mutex);
+
+        processChannels();
+    }
+}
+
+void DSDDecoderPool::processChannels()
+{
+    pthread_mutex_lock(&m_mutex);
+
+    while (m_nextChannel < m_nbChannels)
+    {
+        int channel = m_nextChannel++;
+        pthread_mutex_unlock(&m_mutex);
+
+        m_decoders[channel]->runBlock(m_blockSamples[channel], m_blockNbSamples[channel]);
+
+        pthread_mutex_lock(&m_mutex);
+
+        if (++m_nbChannelsDone == m_nbChannels) {
+            pthread_cond_signal(&m_doneCond);
+        }
+    }
+
+    pthread_mutex_unlock(&m_mutex);
+}
+
+} // namespace DSDcc
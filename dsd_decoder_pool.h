@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DSDCC_DSD_DECODER_POOL_H_
+#define DSDCC_DSD_DECODER_POOL_H_
+
+#include <pthread.h>
+#include "dsd_decoder.h"
+
+namespace DSDcc
+{
+
+/**
+ * Owns a set of decoders one per channel and runs blocks of samples through them on a pool of worker threads.
+ * Each call processes one block for every channel and returns when all channels are done. A channel is handled
+ * by a single thread during a call and calls are sequential so samples of a channel are always processed in order.
+ * Results (audio, DV frames, status) are then read from each decoder between calls.
+ */
+class DSDDecoderPool
+{
+public:
+    DSDDecoderPool(int nbChannels, int nbThreads, DSDFilters::DSDFilterArithmetic filterArithmetic = DSDFilters::DSDFilterFloat); //!< nbThreads includes the calling thread. 1 or less: run in the calling thread
+    ~DSDDecoderPool();
+
+    int getNbChannels() const { return m_nbChannels; }
+    int getNbThreads() const { return m_nbWorkers + 1; }
+    DSDDecoder& getDecoder(int channel) { return *m_decoders[channel]; }
+
+    void runBlocks(const short * const *samples, const int *nbSamples); //!< one block per channel
+    void runInterleaved(const short *samples, int nbFrames); //!< nbFrames frames of nbChannels interleaved samples
+
+private:
+    static void *workerThread(void *arg);
+    void workerLoop();
+    void processChannels();
+
+    int m_nbChannels;
+    DSDDecoder **m_decoders;
+    short **m_channelBuffers;      //!< de-interleaved samples
+    int m_channelBufferSize;
+    const short **m_blockSamples;  //!< current block of each channel
+    int *m_blockNbSamples;
+
+    int m_nbWorkers;               //!< worker threads in addition to the calling thread
+    pthread_t *m_workers;
+    pthread_mutex_t m_mutex;
+    pthread_cond_t m_startCond;
+    pthread_cond_t m_doneCond;
+    unsigned int m_generation;     //!< incremented for each new set of blocks
+    int m_nextChannel;             //!< next channel to be picked by a thread
+    int m_nbChannelsDone;
+    bool m_stop;
+};
+
+} // namespace DSDcc
+
+#endif /* DSDCC_DSD_DECODER_POOL_H_ */
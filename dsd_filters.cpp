@@ -17,6 +17,13 @@
 #include <cmath>
 #include "dsd_filters.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace DSDcc
 {
 
@@ -26,7 +33,7 @@ const float DSDFilters::dmrgain = 6.82973073748f;
 const float DSDFilters::dpmrgain = 14.6083498224f;
 
 // DMR filter - DSD original for 4800 baud - root raised cosine alpha=0.2 Ts = 6000 S/s Fc = 48kHz - zero at boundaries
-const float DSDFilters::xcoeffs[] =
+const float DSDFilters::xcoeffs[NZEROS_PADDED] =
 {  -0.0083649323f, -0.0265444850f, -0.0428141462f, -0.0537571943f,
         -0.0564141052f, -0.0489161045f, -0.0310068662f, -0.0043393881f,
         +0.0275375106f, +0.0595423283f, +0.0857543325f, +0.1003565948f,
@@ -45,7 +52,7 @@ const float DSDFilters::xcoeffs[] =
         -0.0083649323f, };
 
 // NXDN filter - DSD original for 2400 baud - root raised cosine alpha=0.2 Ts = 3000 S/s Fc = 48 kHz
-const float DSDFilters::nxcoeffs[] =
+const float DSDFilters::nxcoeffs[NXZEROS_PADDED] =
 { +0.031462429f, +0.031747267f, +0.030401148f, +0.027362877f, +0.022653298f,
         +0.016379869f, +0.008737200f, +0.000003302f, -0.009468531f,
         -0.019262057f, -0.028914291f, -0.037935027f, -0.045828927f,
@@ -82,11 +89,11 @@ const float DSDFilters::nxcoeffs[] =
         +0.031747267f, +0.031462429f, };
 
 // DMR filter - root raised cosine alpha=0.7 Ts = 6650 S/s Fc = 48kHz
-const float DSDFilters::dmrcoeffs[] =
+const float DSDFilters::dmrcoeffs[NZEROS_PADDED] =
 {0.0301506278, 0.0269200615, 0.0159662432, -0.0013114705, -0.0216605133, -0.0404938748, -0.0528141756, -0.0543747957, -0.0428325003, -0.0186176083, 0.0147202645, 0.0508418571, 0.0816392577, 0.0988113688, 0.0957187780, 0.0691512084, 0.0206194642, -0.0431564563, -0.1107569268, -0.1675773224, -0.1981519842, -0.1889130786, -0.1308939560, -0.0218608492, 0.1325685970, 0.3190962499, 0.5182530574, 0.7070497652, 0.8623526878, 0.9644213921, 1.0000000000, 0.9644213921, 0.8623526878, 0.7070497652, 0.5182530574, 0.3190962499, 0.1325685970, -0.0218608492, -0.1308939560, -0.1889130786, -0.1981519842, -0.1675773224, -0.1107569268, -0.0431564563, 0.0206194642, 0.0691512084, 0.0957187780, 0.0988113688, 0.0816392577, 0.0508418571, 0.0147202645, -0.0186176083, -0.0428325003, -0.0543747957, -0.0528141756, -0.0404938748, -0.0216605133, -0.0013114705, 0.0159662432, 0.0269200615, 0.0301506278};
 
 // dPMR filter - root raised cosine alpha=0.2 Ts = 3325 S/s Fc = 48 kHz - zero at boundaries appears to be slightly better
-const float DSDFilters::dpmrcoeffs[] =
+const float DSDFilters::dpmrcoeffs[NXZEROS_PADDED] =
 {-0.0000983004, 0.0058388841, 0.0119748846, 0.0179185547, 0.0232592816,
         0.0275919612, 0.0305433586, 0.0317982965, 0.0311240307,
         0.0283911865, 0.0235897433, 0.0168387650, 0.0083888763,
@@ -122,14 +129,47 @@ const float DSDFilters::dpmrcoeffs[] =
         0.0275919612, 0.0232592816, 0.0179185547, 0.0119748846,
         0.0058388841, -0.0000983004};
 
-DSDFilters::DSDFilters()
+DSDFilters::DSDFilters(DSDFilterArithmetic arithmetic) :
+        m_arithmetic(arithmetic)
 {
-    for (int i=0; i < NZEROS+1; i++) {
-        xv[i] = 0.0f;
+    for (unsigned int i = 0; i < sizeof(m_xv)/sizeof(float); i++) {
+        m_xv[i] = 0.0f;
+    }
+
+    for (unsigned int i = 0; i < sizeof(m_nxv)/sizeof(float); i++) {
+        m_nxv[i] = 0.0f;
+    }
+
+    for (unsigned int i = 0; i < sizeof(m_xvFixed)/sizeof(short); i++) {
+        m_xvFixed[i] = 0;
     }
 
-    for (int i=0; i < NXZEROS+1; i++) {
-        nxv[i] = 0.0f;
+    for (unsigned int i = 0; i < sizeof(m_nxvFixed)/sizeof(short); i++) {
+        m_nxvFixed[i] = 0;
+    }
+
+    m_xHistory.m_v = m_xv;
+    m_xHistory.m_length = NZEROS+1;
+    m_xHistory.m_index = 0;
+    m_nxHistory.m_v = m_nxv;
+    m_nxHistory.m_length = NXZEROS+1;
+    m_nxHistory.m_index = 0;
+    m_xHistoryFixed.m_v = m_xvFixed;
+    m_xHistoryFixed.m_length = NZEROS+1;
+    m_xHistoryFixed.m_index = 0;
+    m_nxHistoryFixed.m_v = m_nxvFixed;
+    m_nxHistoryFixed.m_length = NXZEROS+1;
+    m_nxHistoryFixed.m_index = 0;
+
+    initFixedCoefficients(m_xcoeffsFixed, &m_coeffsFixedBuffer[0], xcoeffs, NZEROS_PADDED, ngain);
+    initFixedCoefficients(m_dmrcoeffsFixed, &m_coeffsFixedBuffer[NZEROS_PADDED], dmrcoeffs, NZEROS_PADDED, dmrgain);
+    initFixedCoefficients(m_nxcoeffsFixed, &m_coeffsFixedBuffer[2*NZEROS_PADDED], nxcoeffs, NXZEROS_PADDED, nxgain);
+    initFixedCoefficients(m_dpmrcoeffsFixed, &m_coeffsFixedBuffer[2*NZEROS_PADDED + NXZEROS_PADDED], dpmrcoeffs, NXZEROS_PADDED, dpmrgain);
+
+    if (m_arithmetic == DSDFilterFixedPoint) {
+        m_dotProductFixed = selectDotProductFixed(m_kernelName);
+    } else {
+        m_dotProduct = selectDotProduct(m_kernelName);
     }
 }
 
@@ -147,64 +187,373 @@ short DSDFilters::nxdn_filter(short sample) // all 2400 baud filters for now
     return dsd_input_filter(sample, 4);
 }
 
-short DSDFilters::dsd_input_filter(short sample, int mode)
+void DSDFilters::dmr_filter(const short *samples, short *filteredSamples, int nbSamples)
 {
-    float sum;
-    int i;
-    float gain;
-    int zeros;
-    float *v;
-    const float *coeffs;
+    dsd_input_filter(samples, filteredSamples, nbSamples, 3);
+}
 
+void DSDFilters::nxdn_filter(const short *samples, short *filteredSamples, int nbSamples)
+{
+    dsd_input_filter(samples, filteredSamples, nbSamples, 4);
+}
+
+bool DSDFilters::getFilter(int mode, History<float>*& history, const float*& coeffs, int& nbTaps, float& gain)
+{
     switch (mode)
     {
     case 1:
         gain = ngain;
-        v = xv;
+        history = &m_xHistory;
         coeffs = xcoeffs;
-        zeros = NZEROS;
-        break;
+        nbTaps = NZEROS_PADDED;
+        return true;
     case 2:
         gain = nxgain;
-        v = nxv;
+        history = &m_nxHistory;
         coeffs = nxcoeffs;
-        zeros = NXZEROS;
-        break;
+        nbTaps = NXZEROS_PADDED;
+        return true;
     case 3:
         gain = dmrgain;
-        v = xv;
+        history = &m_xHistory;
         coeffs = dmrcoeffs;
-        zeros = NZEROS;
-        break;
+        nbTaps = NZEROS_PADDED;
+        return true;
     case 4:
         gain = dpmrgain;
-        v = nxv;
+        history = &m_nxHistory;
         coeffs = dpmrcoeffs;
-        zeros = NXZEROS;
-        break;
+        nbTaps = NXZEROS_PADDED;
+        return true;
     default:
+        return false;
+    }
+}
+
+bool DSDFilters::getFixedFilter(int mode, History<short>*& history, const FixedCoefficients*& coeffs, int& nbTaps)
+{
+    switch (mode)
+    {
+    case 1:
+        history = &m_xHistoryFixed;
+        coeffs = &m_xcoeffsFixed;
+        nbTaps = NZEROS_PADDED;
+        return true;
+    case 2:
+        history = &m_nxHistoryFixed;
+        coeffs = &m_nxcoeffsFixed;
+        nbTaps = NXZEROS_PADDED;
+        return true;
+    case 3:
+        history = &m_xHistoryFixed;
+        coeffs = &m_dmrcoeffsFixed;
+        nbTaps = NZEROS_PADDED;
+        return true;
+    case 4:
+        history = &m_nxHistoryFixed;
+        coeffs = &m_dpmrcoeffsFixed;
+        nbTaps = NXZEROS_PADDED;
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * Coefficients are divided by the gain so the output needs no further scaling than a shift. The shift is the largest
+ * (at most 15) for which a full scale input cannot overflow the 32 bit accumulator.
+ */
+void DSDFilters::initFixedCoefficients(FixedCoefficients& fixedCoeffs, short *buffer, const float *coeffs, int nbTaps, float gain)
+{
+    double sumAbs = 0.0;
+    double maxAbs = 0.0;
+
+    for (int i = 0; i < nbTaps; i++)
+    {
+        double c = fabs(coeffs[i] / gain);
+        sumAbs += c;
+        maxAbs = c > maxAbs ? c : maxAbs;
+    }
+
+    int shift = 15;
+
+    while ((shift > 0) && ((sumAbs * (1<<shift) * 32768.0 >= 2147483647.0) || (maxAbs * (1<<shift) >= 32767.0))) {
+        shift--;
+    }
+
+    for (int i = 0; i < nbTaps; i++) {
+        buffer[i] = (short) floor((coeffs[i] / gain) * (1<<shift) + 0.5);
+    }
+
+    fixedCoeffs.m_coeffs = buffer;
+    fixedCoeffs.m_shift = shift;
+}
+
+short DSDFilters::scaleFixed(int acc, int shift)
+{
+    int y = acc / (1<<shift); // truncate towards zero like the float to short conversion
+
+    if (y > 32767) {
+        return 32767;
+    } else if (y < -32768) {
+        return -32768;
+    } else {
+        return y;
+    }
+}
+
+void DSDFilters::dsd_input_filter(const short *samples, short *filteredSamples, int nbSamples, int mode)
+{
+    if (m_arithmetic == DSDFilterFixedPoint)
+    {
+        History<short> *history;
+        const FixedCoefficients *coeffs;
+        int nbTaps;
+
+        if (getFixedFilter(mode, history, coeffs, nbTaps))
+        {
+            for (int i = 0; i < nbSamples; i++)
+            {
+                const short *v = history->push(samples[i]);
+                filteredSamples[i] = scaleFixed((*m_dotProductFixed)(coeffs->m_coeffs, v, nbTaps), coeffs->m_shift);
+            }
+
+            return;
+        }
+    }
+
+    History<float> *history;
+    const float *coeffs;
+    int nbTaps;
+    float gain;
+
+    if ((m_arithmetic == DSDFilterFixedPoint) || !getFilter(mode, history, coeffs, nbTaps, gain))
+    {
+        if (filteredSamples != samples)
+        {
+            for (int i = 0; i < nbSamples; i++) {
+                filteredSamples[i] = samples[i];
+            }
+        }
+
+        return;
+    }
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        const float *v = history->push(samples[i]);
+        filteredSamples[i] = (short) ((*m_dotProduct)(coeffs, v, nbTaps) / gain);
+    }
+}
+
+short DSDFilters::dsd_input_filter(short sample, int mode)
+{
+    if (m_arithmetic == DSDFilterFixedPoint)
+    {
+        History<short> *historyFixed;
+        const FixedCoefficients *coeffsFixed;
+        int nbTapsFixed;
+
+        if (!getFixedFilter(mode, historyFixed, coeffsFixed, nbTapsFixed)) {
+            return sample;
+        }
+
+        const short *v = historyFixed->push(sample);
+        return scaleFixed((*m_dotProductFixed)(coeffsFixed->m_coeffs, v, nbTapsFixed), coeffsFixed->m_shift);
+    }
+
+    History<float> *history;
+    const float *coeffs;
+    int nbTaps;
+    float gain;
+
+    if (!getFilter(mode, history, coeffs, nbTaps, gain)) {
         return sample;
     }
 
-    for (i = 0; i < zeros; i++) {
-        v[i] = v[i + 1];
+    const float *v = history->push(sample); // unfiltered sample in
+    return (short) ((*m_dotProduct)(coeffs, v, nbTaps) / gain); // filtered sample out
+}
+
+/**
+ * All implementations accumulate DSD_FILTER_LANES partial sums (sum k of coeffs[8k+l]*v[8k+l] for lane l)
+ * then add them in the same order: lane l with lane l+4, then the first two with the last two, then the last two.
+ * Thus they all give the exact same result and decoding does not depend on the processor.
+ */
+float DSDFilters::dotProductScalar(const float *coeffs, const float *v, int n)
+{
+    float acc[DSD_FILTER_LANES];
+
+    for (int l = 0; l < DSD_FILTER_LANES; l++) {
+        acc[l] = 0.0f;
+    }
+
+    for (int i = 0; i < n; i += DSD_FILTER_LANES)
+    {
+        for (int l = 0; l < DSD_FILTER_LANES; l++)
+        {
+            float p = coeffs[i+l] * v[i+l];
+            acc[l] += p;
+        }
     }
 
-    v[zeros] = sample; // unfiltered sample in
-    sum = 0.0f;
+    float s0 = acc[0] + acc[4];
+    float s1 = acc[1] + acc[5];
+    float s2 = acc[2] + acc[6];
+    float s3 = acc[3] + acc[7];
+    float t0 = s0 + s2;
+    float t1 = s1 + s3;
+    return t0 + t1;
+}
+
+/** Integer sums do not depend on the order so all fixed point implementations give the same result too */
+int DSDFilters::dotProductFixedScalar(const short *coeffs, const short *v, int n)
+{
+    int acc = 0;
 
-    for (i = 0; i <= zeros; i++) {
-        sum += (coeffs[i] * v[i]);
+    for (int i = 0; i < n; i++) {
+        acc += coeffs[i] * v[i];
     }
 
-    return (short) (sum / gain); // filtered sample out
+    return acc;
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+__attribute__((target("sse2")))
+float DSDFilters::dotProductSSE2(const float *coeffs, const float *v, int n)
+{
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+
+    for (int i = 0; i < n; i += DSD_FILTER_LANES)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&coeffs[i]), _mm_loadu_ps(&v[i])));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&coeffs[i+4]), _mm_loadu_ps(&v[i+4])));
+    }
+
+    __m128 s = _mm_add_ps(acc0, acc1);        // s0 s1 s2 s3
+    __m128 t = _mm_add_ps(s, _mm_movehl_ps(s, s)); // t0 t1 . .
+    t = _mm_add_ss(t, _mm_shuffle_ps(t, t, 1));
+    return _mm_cvtss_f32(t);
+}
+
+__attribute__((target("avx2")))
+float DSDFilters::dotProductAVX2(const float *coeffs, const float *v, int n)
+{
+    __m256 acc = _mm256_setzero_ps();
+
+    for (int i = 0; i < n; i += DSD_FILTER_LANES) {
+        acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(&coeffs[i]), _mm256_loadu_ps(&v[i]))); // no FMA to keep the same rounding
+    }
+
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    __m128 t = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    t = _mm_add_ss(t, _mm_shuffle_ps(t, t, 1));
+    return _mm_cvtss_f32(t);
+}
+
+__attribute__((target("sse2")))
+int DSDFilters::dotProductFixedSSE2(const short *coeffs, const short *v, int n)
+{
+    __m128i acc = _mm_setzero_si128();
+
+    for (int i = 0; i < n; i += DSD_FILTER_LANES) {
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_loadu_si128((const __m128i *) &coeffs[i]), _mm_loadu_si128((const __m128i *) &v[i])));
+    }
+
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(acc);
+}
+
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+float DSDFilters::dotProductNEON(const float *coeffs, const float *v, int n)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+
+    for (int i = 0; i < n; i += DSD_FILTER_LANES)
+    {
+        acc0 = vaddq_f32(acc0, vmulq_f32(vld1q_f32(&coeffs[i]), vld1q_f32(&v[i])));
+        acc1 = vaddq_f32(acc1, vmulq_f32(vld1q_f32(&coeffs[i+4]), vld1q_f32(&v[i+4])));
+    }
+
+    float32x4_t s = vaddq_f32(acc0, acc1);
+    float32x2_t t = vadd_f32(vget_low_f32(s), vget_high_f32(s));
+    return vget_lane_f32(t, 0) + vget_lane_f32(t, 1);
+}
+
+int DSDFilters::dotProductFixedNEON(const short *coeffs, const short *v, int n)
+{
+    int32x4_t acc = vdupq_n_s32(0);
+
+    for (int i = 0; i < n; i += DSD_FILTER_LANES)
+    {
+        acc = vmlal_s16(acc, vld1_s16(&coeffs[i]), vld1_s16(&v[i]));
+        acc = vmlal_s16(acc, vld1_s16(&coeffs[i+4]), vld1_s16(&v[i+4]));
+    }
+
+    int32x2_t t = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+    return vget_lane_s32(t, 0) + vget_lane_s32(t, 1);
+}
+
+#endif
+
+DSDFilters::DotProduct DSDFilters::selectDotProduct(const char*& kernelName)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        kernelName = "avx2";
+        return &dotProductAVX2;
+    }
+
+    if (__builtin_cpu_supports("sse2"))
+    {
+        kernelName = "sse2";
+        return &dotProductSSE2;
+    }
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    kernelName = "neon";
+    return &dotProductNEON;
+#endif
+    kernelName = "scalar";
+    return &dotProductScalar;
+}
+
+DSDFilters::DotProductFixed DSDFilters::selectDotProductFixed(const char*& kernelName)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("sse2"))
+    {
+        kernelName = "sse2 fixed point";
+        return &dotProductFixedSSE2;
+    }
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    kernelName = "neon fixed point";
+    return &dotProductFixedNEON;
+#endif
+    kernelName = "scalar fixed point";
+    return &dotProductFixedScalar;
 }
 
 // ====================================================================
 
-DSDSecondOrderRecursiveFilter::DSDSecondOrderRecursiveFilter(float samplingFrequency, float centerFrequency, float r) :
+DSDSecondOrderRecursiveFilter::DSDSecondOrderRecursiveFilter(float samplingFrequency, float centerFrequency, float r,
+        DSDFilters::DSDFilterArithmetic arithmetic) :
 		m_r(r),
-		m_frequencyRatio(centerFrequency/samplingFrequency)
+		m_frequencyRatio(centerFrequency/samplingFrequency),
+		m_arithmetic(arithmetic)
 {
 	init();
 }
@@ -226,6 +575,10 @@ void DSDSecondOrderRecursiveFilter::setR(float r)
 
 short DSDSecondOrderRecursiveFilter::run(short sample)
 {
+	if (m_arithmetic == DSDFilters::DSDFilterFixedPoint) {
+		return runFixed(sample);
+	}
+
 	m_v[0] = ((1.0f - m_r) * (float) sample) + (2.0f * m_r * cos(2.0*M_PI*m_frequencyRatio) * m_v[1]) - (m_r * m_r * m_v[2]);
 	float y = m_v[0] - m_v[2];
 	m_v[2] = m_v[1];
@@ -234,12 +587,45 @@ short DSDSecondOrderRecursiveFilter::run(short sample)
 	return (short) y;
 }
 
+short DSDSecondOrderRecursiveFilter::runFixed(short sample)
+{
+	int64_t acc = (m_a * (((int64_t) sample) << 12)) + (m_b * m_iv[1]) - (m_c * m_iv[2]);
+	m_iv[0] = (int32_t) ((acc + (1<<29)) >> 30);
+	int32_t y = (m_iv[0] - m_iv[2]) / (1<<12); // truncate towards zero like the float to short conversion
+	m_iv[2] = m_iv[1];
+	m_iv[1] = m_iv[0];
+
+	if (y > 32767) {
+		return 32767;
+	} else if (y < -32768) {
+		return -32768;
+	} else {
+		return y;
+	}
+}
+
 void DSDSecondOrderRecursiveFilter::init()
 {
 	for (int i = 0; i < 3; i++)
 	{
 		m_v[i] = 0.0f;
 	}
+
+	initFixed();
+}
+
+void DSDSecondOrderRecursiveFilter::initFixed()
+{
+	const double q30 = (double) (1<<30);
+
+	m_a = (int64_t) floor((1.0 - m_r) * q30 + 0.5);
+	m_b = (int64_t) floor(2.0 * m_r * cos(2.0*M_PI*m_frequencyRatio) * q30 + 0.5);
+	m_c = (int64_t) floor(m_r * m_r * q30 + 0.5);
+
+	for (int i = 0; i < 3; i++)
+	{
+		m_iv[i] = 0;
+	}
 }
 
 // ====================================================================
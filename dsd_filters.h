@@ -17,9 +17,13 @@
 #ifndef DSDCC_DSD_FILTERS_H_
 #define DSDCC_DSD_FILTERS_H_
 
+#include <stdint.h>
+
 #define NZEROS 60
 #define NXZEROS 134
-
+#define DSD_FILTER_LANES 8 // number of partial sums in the FIR dot product whatever the implementation
+#define NZEROS_PADDED 64   // NZEROS+1 rounded up to a multiple of DSD_FILTER_LANES
+#define NXZEROS_PADDED 136 // NXZEROS+1 rounded up to a multiple of DSD_FILTER_LANES
 
 namespace DSDcc
 {
@@ -27,25 +31,104 @@ namespace DSDcc
 class DSDFilters
 {
 public:
-    DSDFilters();
+    typedef enum
+    {
+        DSDFilterFloat,      //!< floating point
+        DSDFilterFixedPoint  //!< 16 bit coefficients and samples with 32 bit accumulation
+    } DSDFilterArithmetic;
+
+    DSDFilters(DSDFilterArithmetic arithmetic = DSDFilterFloat);
     ~DSDFilters();
 
     static const float ngain;
-    static const float xcoeffs[];
+    static const float xcoeffs[NZEROS_PADDED];    //!< zero padded
     static const float nxgain;
-    static const float nxcoeffs[];
+    static const float nxcoeffs[NXZEROS_PADDED];  //!< zero padded
     static const float dmrgain;
-    static const float dmrcoeffs[];
+    static const float dmrcoeffs[NZEROS_PADDED];  //!< zero padded
     static const float dpmrgain;
-    static const float dpmrcoeffs[];
+    static const float dpmrcoeffs[NXZEROS_PADDED]; //!< zero padded
 
     short dsd_input_filter(short sample, int mode);
     short dmr_filter(short sample);
     short nxdn_filter(short sample);
+    void dsd_input_filter(const short *samples, short *filteredSamples, int nbSamples, int mode); //!< filter a block of samples
+    void dmr_filter(const short *samples, short *filteredSamples, int nbSamples);
+    void nxdn_filter(const short *samples, short *filteredSamples, int nbSamples);
+    const char *getKernelName() const { return m_kernelName; } //!< FIR kernel selected at run time
+    DSDFilterArithmetic getArithmetic() const { return m_arithmetic; }
 
 private:
-    float xv[NZEROS+1];
-    float nxv[NXZEROS+1];
+    /** dot product of n floats with n multiple of DSD_FILTER_LANES */
+    typedef float (*DotProduct)(const float *coeffs, const float *v, int n);
+    /** dot product of n shorts with n multiple of DSD_FILTER_LANES */
+    typedef int (*DotProductFixed)(const short *coeffs, const short *v, int n);
+
+    /**
+     * Circular delay line. Each sample is stored twice at index and index + length so that
+     * the last length samples are always contiguous from index + 1 with no copy.
+     */
+    template<typename T>
+    struct History
+    {
+        T *m_v;
+        int m_length;
+        int m_index;   //!< position of the last sample
+
+        const T *push(short sample)
+        {
+            if (++m_index == m_length) {
+                m_index = 0;
+            }
+
+            m_v[m_index] = sample;
+            m_v[m_index + m_length] = sample;
+            return &m_v[m_index + 1]; // oldest sample first
+        }
+    };
+
+    /** Fixed point version of a filter. Coefficients are normalized by the gain and scaled by 2^shift */
+    struct FixedCoefficients
+    {
+        short *m_coeffs;
+        int m_shift;
+    };
+
+    bool getFilter(int mode, History<float>*& history, const float*& coeffs, int& nbTaps, float& gain);
+    bool getFixedFilter(int mode, History<short>*& history, const FixedCoefficients*& coeffs, int& nbTaps);
+    static void initFixedCoefficients(FixedCoefficients& fixedCoeffs, short *buffer, const float *coeffs, int nbTaps, float gain);
+    static short scaleFixed(int acc, int shift);
+    static DotProduct selectDotProduct(const char*& kernelName);
+    static DotProductFixed selectDotProductFixed(const char*& kernelName);
+    static float dotProductScalar(const float *coeffs, const float *v, int n);
+    static int dotProductFixedScalar(const short *coeffs, const short *v, int n);
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    static float dotProductSSE2(const float *coeffs, const float *v, int n);
+    static float dotProductAVX2(const float *coeffs, const float *v, int n);
+    static int dotProductFixedSSE2(const short *coeffs, const short *v, int n);
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    static float dotProductNEON(const float *coeffs, const float *v, int n);
+    static int dotProductFixedNEON(const short *coeffs, const short *v, int n);
+#endif
+
+    DSDFilterArithmetic m_arithmetic;
+    float m_xv[2*(NZEROS+1) + NZEROS_PADDED - (NZEROS+1)];    //!< history for 4800 baud filters. Padded for last partial sums
+    float m_nxv[2*(NXZEROS+1) + NXZEROS_PADDED - (NXZEROS+1)]; //!< history for 2400 baud filters. Padded for last partial sums
+    History<float> m_xHistory;
+    History<float> m_nxHistory;
+    DotProduct m_dotProduct;
+    short m_xvFixed[2*(NZEROS+1) + NZEROS_PADDED - (NZEROS+1)];    //!< fixed point history for 4800 baud filters
+    short m_nxvFixed[2*(NXZEROS+1) + NXZEROS_PADDED - (NXZEROS+1)]; //!< fixed point history for 2400 baud filters
+    History<short> m_xHistoryFixed;
+    History<short> m_nxHistoryFixed;
+    short m_coeffsFixedBuffer[2*NZEROS_PADDED + 2*NXZEROS_PADDED];
+    FixedCoefficients m_xcoeffsFixed;
+    FixedCoefficients m_nxcoeffsFixed;
+    FixedCoefficients m_dmrcoeffsFixed;
+    FixedCoefficients m_dpmrcoeffsFixed;
+    DotProductFixed m_dotProductFixed;
+    const char *m_kernelName;
 };
 
 /**
@@ -55,7 +138,8 @@ private:
 class DSDSecondOrderRecursiveFilter
 {
 public:
-    DSDSecondOrderRecursiveFilter(float samplingFrequency, float centerFrequency, float r);
+    DSDSecondOrderRecursiveFilter(float samplingFrequency, float centerFrequency, float r,
+            DSDFilters::DSDFilterArithmetic arithmetic = DSDFilters::DSDFilterFloat);
     ~DSDSecondOrderRecursiveFilter();
 
     void setFrequencies(float samplingFrequency, float centerFrequency);
@@ -64,10 +148,17 @@ public:
 
 private:
     void init();
+    void initFixed();
+    short runFixed(short sample);
 
     float m_r;
     float m_frequencyRatio;
     float m_v[3];
+    DSDFilters::DSDFilterArithmetic m_arithmetic;
+    int64_t m_a;      //!< fixed point (1 - r) Q30
+    int64_t m_b;      //!< fixed point 2r.cos(2.pi.f) Q30
+    int64_t m_c;      //!< fixed point r^2 Q30
+    int32_t m_iv[3];  //!< fixed point state Q12
 };
 
 /**
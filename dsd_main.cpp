@@ -19,16 +19,25 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <math.h>
+#include <errno.h>
 
 #include "dsd_decoder.h"
+#include "dsd_decoder_pool.h"
 #include "dsd_upsample.h"
 
 #ifdef DSD_USE_SERIALDV
 #include "dvcontroller.h"
 #endif
+
+#define DSDCCX_DECODE_BLOCK_SAMPLES 4800 // 100ms of signal pushed to the decoder at once
+#define DSDCCX_MAX_CHANNELS 256
+#define DSDCCX_OPTIONS "hep:qtv:i:o:g:nR:f:u:U:lL:D:d:T:M:m:P:Q:b:c:j:IS:AC"
+
 int exitflag;
+volatile sig_atomic_t perfdumpflag;
 
 class Mixer
 {
@@ -50,8 +59,7 @@ private:
 
 void Mixer::mix(int size1, int size2, short *channel1, short *channel2)
 {
-    int m_mixSize = std::max(size1, size2);
-    short mixedSample;
+    m_mixSize = std::max(size1, size2);
 
     if (m_mixSize > m_mixSizeMax)
     {
@@ -60,11 +68,11 @@ void Mixer::mix(int size1, int size2, short *channel1, short *channel2)
             delete[] m_mix;
         }
 
-        m_mix = new short[m_mixSizeMax];
         m_mixSizeMax = m_mixSize;
+        m_mix = new short[m_mixSizeMax];
     }
 
-    for (int i = 0; i < m_mixSize; i++)
+    for (int i = 0; i < (int) m_mixSize; i++)
     {
         if (i < size1) {
             m_mix[i] = channel1[i];
@@ -80,8 +88,345 @@ void Mixer::mix(int size1, int size2, short *channel1, short *channel2)
     }
 }
 
+/**
+ * Reads the S16LE input by large chunks. Regular files are memory mapped and chunks are taken directly from
+ * the mapping. Other inputs (pipes, devices) are read with read() calls of up to the chunk size.
+ * Input is made of frames of one sample per channel and only whole frames are returned.
+ */
+class SampleReader
+{
+public:
+    SampleReader(int fd, int chunkSize, int nbChannels);
+    ~SampleReader();
+    const short *read(int& nbFrames); //!< get next chunk of frames. nbFrames is 0 at end of input
+    bool isMapped() const { return m_map != 0; }
+
+private:
+    int m_fd;
+    int m_frameSize;     //!< in bytes
+    int m_chunkSize;     //!< in bytes
+    char *m_buffer;
+    int m_leftover;      //!< number of bytes of an incomplete frame left from previous read
+    int m_leftoverIndex; //!< position of these bytes in the buffer
+    char *m_map;
+    size_t m_mapSize;
+    size_t m_mapIndex;
+};
+
+SampleReader::SampleReader(int fd, int chunkSize, int nbChannels) :
+    m_fd(fd),
+    m_frameSize(nbChannels * sizeof(short)),
+    m_buffer(0),
+    m_leftover(0),
+    m_leftoverIndex(0),
+    m_map(0),
+    m_mapSize(0),
+    m_mapIndex(0)
+{
+    struct stat st;
+
+    m_chunkSize = std::max(chunkSize - (chunkSize % m_frameSize), m_frameSize);
+
+    if ((fstat(m_fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0))
+    {
+        void *map = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+
+        if (map != MAP_FAILED)
+        {
+            m_map = (char *) map;
+            m_mapSize = st.st_size;
+            madvise(m_map, m_mapSize, MADV_SEQUENTIAL);
+        }
+    }
+
+    if (m_map == 0) {
+        m_buffer = new char[m_chunkSize];
+    }
+}
+
+SampleReader::~SampleReader()
+{
+    if (m_map != 0) {
+        munmap(m_map, m_mapSize);
+    }
+
+    if (m_buffer != 0) {
+        delete[] m_buffer;
+    }
+}
+
+const short *SampleReader::read(int& nbFrames)
+{
+    if (m_map != 0)
+    {
+        size_t nbBytes = std::min((size_t) m_chunkSize, (m_mapSize - (m_mapSize % m_frameSize)) - m_mapIndex);
+        const short *samples = (const short *) &m_map[m_mapIndex];
+        m_mapIndex += nbBytes;
+        nbFrames = nbBytes / m_frameSize;
+        return samples;
+    }
+
+    int nbBytes = 0;
+
+    if (m_leftover)
+    {
+        memmove(m_buffer, &m_buffer[m_leftoverIndex], m_leftover);
+        nbBytes = m_leftover;
+    }
+
+    while (nbBytes < m_frameSize) // wait for at least one frame unless the input is exhausted
+    {
+        int result = ::read(m_fd, (void *) &m_buffer[nbBytes], m_chunkSize - nbBytes);
+
+        if (result > 0)
+        {
+            nbBytes += result;
+        }
+        else if ((result < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else
+        {
+            nbFrames = 0;
+            return (const short *) m_buffer;
+        }
+    }
+
+    nbFrames = nbBytes / m_frameSize;
+    m_leftover = nbBytes % m_frameSize;
+    m_leftoverIndex = nbBytes - m_leftover;
+
+    return (const short *) m_buffer;
+}
+
+/**
+ * Accumulates audio samples and writes them in one write() call when flushed
+ */
+class AudioWriter
+{
+public:
+    AudioWriter(int fd) : m_fd(fd), m_buffer(0), m_size(0), m_sizeMax(0) {}
+    ~AudioWriter() {
+        if (m_buffer != 0) {
+            delete[] m_buffer;
+        }
+    }
+    void push(const short *samples, int nbSamples);
+    void flush();
+
+private:
+    int m_fd;
+    short *m_buffer;
+    int m_size;
+    int m_sizeMax;
+};
+
+void AudioWriter::push(const short *samples, int nbSamples)
+{
+    if (m_size + nbSamples > m_sizeMax)
+    {
+        int sizeMax = std::max(2*m_sizeMax, m_size + nbSamples);
+        short *buffer = new short[sizeMax];
+
+        if (m_buffer != 0)
+        {
+            memcpy(buffer, m_buffer, m_size * sizeof(short));
+            delete[] m_buffer;
+        }
+
+        m_buffer = buffer;
+        m_sizeMax = sizeMax;
+    }
+
+    memcpy(&m_buffer[m_size], samples, nbSamples * sizeof(short));
+    m_size += nbSamples;
+}
+
+void AudioWriter::flush()
+{
+    const char *p = (const char *) m_buffer;
+    int nbBytes = m_size * sizeof(short);
+
+    while (nbBytes > 0)
+    {
+        int result = write(m_fd, (const void *) p, nbBytes);
+
+        if (result < 0)
+        {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            fprintf(stderr, "Error writing to output\n");
+            break;
+        }
+
+        p += result;
+        nbBytes -= result;
+    }
+
+    m_size = 0;
+}
+
 static void usage ();
 static void sigfun (int sig);
+static void sigperf (int sig);
+
+/**
+ * Decoding stages time of each channel. Only meaningful when the library is compiled with DSD_USE_PERF_STATS
+ */
+static void printPerfStats(DSDcc::DSDDecoderPool& decoderPool, int nbChannels)
+{
+    for (int ch = 0; ch < nbChannels; ch++)
+    {
+        if (nbChannels > 1) {
+            fprintf(stderr, "Channel %d:\n", ch);
+        }
+
+        decoderPool.getDecoder(ch).getPerfStats().print(stderr);
+    }
+}
+
+/**
+ * Decoder settings of the command line. Parsed once and applied to the decoder of each channel.
+ * Settings left at -1 or false are not applied so the decoder keeps its defaults
+ */
+struct DecoderOptions
+{
+    DecoderOptions() :
+        m_quiet(false),
+        m_errorBars(false),
+        m_symbolTiming(false),
+        m_verbosity(-1),
+        m_p25EncryptionSyncBits(false),
+        m_p25LinkControlBits(false),
+        m_p25TalkGroupInfo(false),
+        m_p25UnmuteEncrypted(false),
+        m_audioGainSet(false),
+        m_audioGain(0.0f),
+        m_audioOutOff(false),
+        m_resumeTDULCFrames(-1),
+        m_dataRate(-1),
+        m_decodeModeSet(false),
+        m_decodeMode(DSDcc::DSDDecoder::DSDDecodeNone),
+        m_uvQuality(-1),
+        m_upsampling(-1),
+        m_cosineFilterOff(false),
+        m_syncMaxMismatches(-1),
+        m_mbeAsync(false),
+        m_levelCentroids(false)
+    {}
+
+    bool m_quiet;
+    bool m_errorBars;
+    bool m_symbolTiming;
+    int  m_verbosity;
+    bool m_p25EncryptionSyncBits;
+    bool m_p25LinkControlBits;
+    bool m_p25TalkGroupInfo;
+    bool m_p25UnmuteEncrypted;
+    bool m_audioGainSet;
+    float m_audioGain;
+    bool m_audioOutOff;
+    int  m_resumeTDULCFrames;
+    int  m_dataRate;              //!< DSDDecoder::DSDRate index
+    bool m_decodeModeSet;
+    DSDcc::DSDDecoder::DSDDecodeMode m_decodeMode; //!< DSDDecodeNone for an unknown -f letter which disables all modes
+    int  m_uvQuality;
+    int  m_upsampling;
+    bool m_cosineFilterOff;
+    int  m_syncMaxMismatches;
+    bool m_mbeAsync;
+    bool m_levelCentroids;
+};
+
+/**
+ * Quiet mode is applied first so that -e and -v override it and the decode mode before the data rate
+ * so that -d overrides the mode default rate
+ */
+static void applyDecoderOptions(DSDcc::DSDDecoder& dsdDecoder, const DecoderOptions& options)
+{
+    if (options.m_quiet) {
+        dsdDecoder.setQuiet();
+    }
+    if (options.m_errorBars) {
+        dsdDecoder.showErrorBars();
+    }
+    if (options.m_symbolTiming) {
+        dsdDecoder.showSymbolTiming();
+    }
+    if (options.m_verbosity >= 0) {
+        dsdDecoder.setLogVerbosity(options.m_verbosity);
+    }
+    if (options.m_p25EncryptionSyncBits) {
+        dsdDecoder.setP25DisplayOptions(DSDcc::DSDDecoder::DSDShowP25EncryptionSyncBits, true);
+    }
+    if (options.m_p25LinkControlBits) {
+        dsdDecoder.setP25DisplayOptions(DSDcc::DSDDecoder::DSDShowP25LinkControlBits, true);
+    }
+    if (options.m_p25TalkGroupInfo) {
+        dsdDecoder.setP25DisplayOptions(DSDcc::DSDDecoder::DSDShowP25TalkGroupInfo, true);
+    }
+    if (options.m_p25UnmuteEncrypted) {
+        dsdDecoder.muteEncryptedP25(false);
+    }
+    if (options.m_audioGainSet) {
+        dsdDecoder.setAudioGain(options.m_audioGain);
+    }
+    if (options.m_audioOutOff) {
+        dsdDecoder.enableAudioOut(false);
+    }
+    if (options.m_resumeTDULCFrames >= 0) {
+        dsdDecoder.enableScanResumeAfterTDULCFrames(options.m_resumeTDULCFrames);
+    }
+    if (options.m_decodeModeSet)
+    {
+        dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeNone, true);
+
+        if (options.m_decodeMode != DSDcc::DSDDecoder::DSDDecodeNone) {
+            dsdDecoder.setDecodeMode(options.m_decodeMode, true);
+        }
+    }
+    if (options.m_dataRate >= 0) {
+        dsdDecoder.setDataRate((DSDcc::DSDDecoder::DSDRate) options.m_dataRate);
+    }
+    if (options.m_uvQuality >= 0) {
+        dsdDecoder.setUvQuality(options.m_uvQuality);
+    }
+    if (options.m_upsampling >= 0) {
+        dsdDecoder.setUpsampling(options.m_upsampling);
+    }
+    if (options.m_cosineFilterOff) {
+        dsdDecoder.enableCosineFiltering(false);
+    }
+    if (options.m_syncMaxMismatches >= 0) {
+        dsdDecoder.setSyncMaxMismatches(DSDcc::DSDDecoder::DSDDecodeAuto, options.m_syncMaxMismatches);
+    }
+    if (options.m_mbeAsync) {
+        dsdDecoder.enableMbeAsync(true);
+    }
+    if (options.m_levelCentroids) {
+        dsdDecoder.setLevelTracking(DSDcc::DSDSymbol::DSDLevelsCentroids);
+    }
+}
+
+/**
+ * With more than one channel each channel has its own output files suffixed with the channel number
+ */
+static std::string channelFileName(const char *fileName, int channel, int nbChannels)
+{
+    std::string channelFile(fileName);
+
+    if (nbChannels > 1)
+    {
+        char suffix[16];
+        snprintf(suffix, 16, ".%d", channel);
+        channelFile += suffix;
+    }
+
+    return channelFile;
+}
 
 void usage()
 {
@@ -103,6 +448,11 @@ void usage()
     fprintf(stderr, "Input/Output options:\n");
     fprintf(stderr, "  -i <device>   Audio input device (default is /dev/audio, - for piped stdin)\n");
     fprintf(stderr, "  -o <device>   Audio output device (default is /dev/audio, - for stdout)\n");
+    fprintf(stderr, "  -b <num>      Input read chunk size in kilobytes (default 64). Regular files are memory mapped\n");
+    fprintf(stderr, "  -c <num>      Number of channels interleaved in the input (default 1, max 256)\n");
+    fprintf(stderr, "                With more than one channel the audio output, log (-L) and formatted messages (-M)\n");
+    fprintf(stderr, "                file names are suffixed with .<channel> (.0, .1, ...). Output cannot be stdout\n");
+    fprintf(stderr, "  -j <num>      Number of decoding threads when decoding several channels (default 1)\n");
     fprintf(stderr, "  -g <num>      Audio output gain (default = 0 = auto, disable = -1)\n");
     fprintf(stderr, "  -U <num>      Audio output upsampling\n");
     fprintf(stderr, "                0: no upsampling (8k) default\n");
@@ -141,8 +491,13 @@ void usage()
     fprintf(stderr, "     2          slot #2\n");
     fprintf(stderr, "     3          slots #1+2 mixed\n");
     fprintf(stderr, "  -l            Disable matched filter\n");
+    fprintf(stderr, "  -I            Use fixed point (integer) arithmetic in matched and symbol sync filters\n");
+    fprintf(stderr, "  -S <num>      Maximum number of mismatched symbols allowed in sync patterns (default 0)\n");
+    fprintf(stderr, "                Capped to a quarter of the pattern length\n");
+    fprintf(stderr, "  -C            Place symbol decision thresholds between the tracked levels of the symbols instead of min/max\n");
     fprintf(stderr, "  -pu           Unmute Encrypted P25 - not supported\n");
     fprintf(stderr, "  -u <num>      Unvoiced speech quality (default=3)\n");
+    fprintf(stderr, "  -A            Queue AMBE/IMBE frames and synthesize audio apart from the sample processing\n");
 #ifdef DSD_USE_SERIALDV
     fprintf(stderr, "  -D <device>   Use DVSI AMBE3000 based device for AMBE decoding (e.g. ThumbDV)\n");
     fprintf(stderr, "                You must have compiled with serialDV support (see Readme.md)\n");
@@ -153,6 +508,9 @@ void usage()
     fprintf(stderr, "                This is useful when status messages (see -M option) contain geographical data\n");
     fprintf(stderr, "                Practically this is only applicable to D-Star\n");
     fprintf(stderr, "\n");
+    fprintf(stderr, "When compiled with -DUSE_PERF_STATS=ON the time spent in each decoding stage is printed\n");
+    fprintf(stderr, "on exit and when the process receives SIGUSR1\n");
+    fprintf(stderr, "\n");
     exit(0);
 }
 
@@ -162,39 +520,49 @@ void sigfun(int sig)
     signal(SIGINT, SIG_DFL);
 }
 
+void sigperf(int sig)
+{
+    perfdumpflag = 1;
+}
+
 int main(int argc, char **argv)
 {
     int c;
     extern char *optarg;
     extern int optind, opterr, optopt;
-    DSDcc::DSDDecoder dsdDecoder;
     DSDcc::DSDUpsampler upsamplingEngine;
     char in_file[1023];
     int  in_file_fd = -1;
     char out_file[1023];
-    int  out_file_fd = -1;
     char log_file[1023];
     log_file[0] = '\0';
     char formattext_file[1023];
     formattext_file[0] = '\0';
-    FILE *formattext_fp = 0;
     float formattext_refresh = 0.1f;
-    char formattext[128];
     char serialDevice[16];
     std::string dvSerialDevice;
     int dvGain_dB = 0;
     int slots = 1;
-    Mixer mixer;
     float lat = 0.0f;
     float lon = 0.0f;
+    int readChunkKiB = 64;
+    int nbChannels = 1;
+    int nbThreads = 1;
+    DSDcc::DSDFilters::DSDFilterArithmetic filterArithmetic = DSDcc::DSDFilters::DSDFilterFloat;
 
     fprintf(stderr, "Digital Speech Decoder DSDcc\n");
 
     exitflag = 0;
+    perfdumpflag = 0;
     signal(SIGINT, sigfun);
 
-    while ((c = getopt(argc, argv,
-            "hep:qtv:i:o:g:nR:f:u:U:lL:D:d:T:M:m:P:Q:")) != -1)
+    if (DSDcc::DSDDecoder::perfStatsEnabled()) {
+        signal(SIGUSR1, sigperf); // dump the decoding stages time on demand
+    }
+
+    DecoderOptions decoderOptions;
+
+    while ((c = getopt(argc, argv, DSDCCX_OPTIONS)) != -1)
     {
         opterr = 0;
         switch (c)
@@ -203,40 +571,40 @@ int main(int argc, char **argv)
             usage();
             exit(0);
         case 'e':
-            dsdDecoder.showErrorBars();
+            decoderOptions.m_errorBars = true;
             break;
         case 'p':
             if (optarg[0] == 'e')
             {
-                dsdDecoder.setP25DisplayOptions(DSDcc::DSDDecoder::DSDShowP25EncryptionSyncBits, true);
+                decoderOptions.m_p25EncryptionSyncBits = true;
             }
             else if (optarg[0] == 'l')
             {
-                dsdDecoder.setP25DisplayOptions(DSDcc::DSDDecoder::DSDShowP25LinkControlBits, true);
+                decoderOptions.m_p25LinkControlBits = true;
             }
             else if (optarg[0] == 's')
             {
-                dsdDecoder.setP25DisplayOptions(DSDcc::DSDDecoder::DSDShowP25EncryptionSyncBits, true);
+                decoderOptions.m_p25EncryptionSyncBits = true;
             }
             else if (optarg[0] == 't')
             {
-                dsdDecoder.setP25DisplayOptions(DSDcc::DSDDecoder::DSDShowP25TalkGroupInfo, true);
+                decoderOptions.m_p25TalkGroupInfo = true;
             }
             else if (optarg[0] == 'u')
             {
-                dsdDecoder.muteEncryptedP25(false);
+                decoderOptions.m_p25UnmuteEncrypted = true;
             }
             break;
         case 'q':
-            dsdDecoder.setQuiet();
+            decoderOptions.m_quiet = true;
             break;
         case 't':
-            dsdDecoder.showSymbolTiming();
+            decoderOptions.m_symbolTiming = true;
             break;
         case 'v':
             int verbosity;
             sscanf(optarg, "%d", &verbosity);
-            dsdDecoder.setLogVerbosity(verbosity);
+            decoderOptions.m_verbosity = verbosity < 0 ? 0 : verbosity;
             break;
         case 'L':
             strncpy(log_file, (const char *) optarg, 1023);
@@ -271,7 +639,8 @@ int main(int argc, char **argv)
         case 'g':
             float gain;
             sscanf(optarg, "%f", &gain);
-            dsdDecoder.setAudioGain(gain);
+            decoderOptions.m_audioGainSet = true;
+            decoderOptions.m_audioGain = gain;
 #ifdef DSD_USE_SERIALDV
             if (gain > 0) {
                 dvGain_dB = (int) (10.0f * log10f(gain));
@@ -279,19 +648,19 @@ int main(int argc, char **argv)
 #endif
             break;
         case 'n':
-            dsdDecoder.enableAudioOut(false);
+            decoderOptions.m_audioOutOff = true;
             break;
         case 'R':
             int resume;
             sscanf(optarg, "%d", &resume);
-            dsdDecoder.enableScanResumeAfterTDULCFrames(resume);
+            decoderOptions.m_resumeTDULCFrames = resume < 0 ? 0 : resume;
             break;
         case 'd':
             int dataRateIndex;
             sscanf(optarg, "%d", &dataRateIndex);
             if ((dataRateIndex >= 0) && (dataRateIndex <= 2))
             {
-                dsdDecoder.setDataRate((DSDcc::DSDDecoder::DSDRate) dataRateIndex);
+                decoderOptions.m_dataRate = dataRateIndex;
             }
             break;
         case 'T':
@@ -303,60 +672,61 @@ int main(int argc, char **argv)
             }
             break;
         case 'f':
-            dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeNone, true);
+            decoderOptions.m_decodeModeSet = true;
+            decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeNone;
             if (optarg[0] == 'a') // auto detect
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeAuto, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeAuto;
             }
             else if (optarg[0] == 'r') // DMR/MOTOTRBO
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeDMR, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeDMR;
             }
             else if (optarg[0] == 'd') // D-Star
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeDStar, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeDStar;
             }
             else if (optarg[0] == 'x') // X2-TDMA
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeX2TDMA, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeX2TDMA;
             }
             else if (optarg[0] == 'p') // ProVoice
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeProVoice, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeProVoice;
             }
             else if (optarg[0] == '0') // P25 Phase 1
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeP25P1, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeP25P1;
             }
             else if (optarg[0] == 'i') // NXDN48 IDAS
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeNXDN48, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeNXDN48;
             }
             else if (optarg[0] == 'n') // NXDN96
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeNXDN96, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeNXDN96;
             }
             else if (optarg[0] == 'm') // DPMR Tier 1 or 2
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeDPMR, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeDPMR;
             }
             else if (optarg[0] == 'y') // YSF
             {
-                dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeYSF, true);
+                decoderOptions.m_decodeMode = DSDcc::DSDDecoder::DSDDecodeYSF;
             }
             break;
         case 'u':
             int uvquality;
             sscanf(optarg, "%i", &uvquality);
-            dsdDecoder.setUvQuality(uvquality);
+            decoderOptions.m_uvQuality = uvquality < 1 ? 1 : uvquality;
             break;
         case 'U':
             int upsampling;
             sscanf(optarg, "%d", &upsampling);
-            dsdDecoder.setUpsampling(upsampling);
+            decoderOptions.m_upsampling = upsampling < 0 ? 0 : upsampling;
             break;
         case 'l':
-            dsdDecoder.enableCosineFiltering(false);
+            decoderOptions.m_cosineFilterOff = true;
             break;
         case 'P':
             sscanf(optarg, "%f", &lat);
@@ -364,16 +734,62 @@ int main(int argc, char **argv)
         case 'Q':
             sscanf(optarg, "%f", &lon);
             break;
+        case 'c':
+            int tmpChannels;
+            sscanf(optarg, "%d", &tmpChannels);
+            if ((tmpChannels > 0) && (tmpChannels <= DSDCCX_MAX_CHANNELS)) {
+                nbChannels = tmpChannels;
+            }
+            break;
+        case 'j':
+            sscanf(optarg, "%d", &nbThreads);
+            break;
+        case 'I':
+            filterArithmetic = DSDcc::DSDFilters::DSDFilterFixedPoint;
+            break;
+        case 'b':
+            int chunkKiB;
+            sscanf(optarg, "%d", &chunkKiB);
+            if ((chunkKiB > 0) && (chunkKiB <= 65536)) {
+                readChunkKiB = chunkKiB;
+            }
+            break;
+        case 'S':
+            int maxMismatches;
+            sscanf(optarg, "%d", &maxMismatches);
+            decoderOptions.m_syncMaxMismatches = maxMismatches < 0 ? 0 : maxMismatches;
+            break;
+        case 'A':
+            decoderOptions.m_mbeAsync = true;
+            break;
+        case 'C':
+            decoderOptions.m_levelCentroids = true;
+            break;
         default:
             usage();
             exit(0);
         }
     }
 
-    dsdDecoder.setMyPoint(lat, lon);
+    DSDcc::DSDDecoderPool decoderPool(nbChannels, nbThreads, filterArithmetic);
+
+    for (int ch = 0; ch < nbChannels; ch++) {
+        applyDecoderOptions(decoderPool.getDecoder(ch), decoderOptions);
+    }
+
+    if (decoderOptions.m_syncMaxMismatches >= 0) {
+        fprintf(stderr, "Allowing %d mismatched sync symbols at most\n", decoderPool.getDecoder(0).getSyncMaxMismatches(DSDcc::DSDDecoder::DSDDecodeDMR));
+    }
+
+    for (int ch = 0; ch < nbChannels; ch++)
+    {
+        decoderPool.getDecoder(ch).setMyPoint(lat, lon);
 
-    if (strlen(log_file) > 0) {
-        dsdDecoder.setLogFile(log_file);
+        if (strlen(log_file) > 0)
+        {
+            std::string channelLogFile = channelFileName(log_file, ch, nbChannels);
+            decoderPool.getDecoder(ch).setLogFile(channelLogFile.c_str());
+        }
     }
 
     if (strncmp(in_file, (const char *) "-", 1) == 0)
@@ -395,39 +811,58 @@ int main(int argc, char **argv)
         return 0;
     }
 
-    if (strncmp(out_file, (const char *) "-", 1) == 0)
-    {
-        out_file_fd = STDOUT_FILENO;
-    }
-    else
-    {
-        out_file_fd = open(out_file, O_WRONLY|O_CREAT|O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
-    }
+    int *out_file_fds = new int[nbChannels];
+    AudioWriter **audioWriters = new AudioWriter*[nbChannels];
+    Mixer *mixers = new Mixer[nbChannels];
+    FILE **formattext_fps = new FILE*[nbChannels];
+    char (*formattexts)[128] = new char[nbChannels][128]; // status text is updated in place so it is kept per channel
 
-    if (out_file_fd > -1)
+    for (int ch = 0; ch < nbChannels; ch++)
     {
-        fprintf(stderr, "Opened %s for output.\n", in_file);
+        out_file_fds[ch] = -1;
+        audioWriters[ch] = 0;
+        formattext_fps[ch] = 0;
     }
-    else
+
+    for (int ch = 0; ch < nbChannels; ch++)
     {
-        if (in_file_fd != STDIN_FILENO) {
-            close(in_file_fd);
+        std::string channelOutFile = channelFileName(out_file, ch, nbChannels);
+
+        if (strncmp(out_file, (const char *) "-", 1) == 0)
+        {
+            out_file_fds[ch] = (nbChannels == 1) ? STDOUT_FILENO : -1;
+        }
+        else
+        {
+            out_file_fds[ch] = open(channelOutFile.c_str(), O_WRONLY|O_CREAT|O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
         }
 
-        fprintf(stderr, "Cannot open %s for output. Aborting\n", out_file);
-        return 0;
+        if (out_file_fds[ch] > -1)
+        {
+            fprintf(stderr, "Opened %s for output.\n", channelOutFile.c_str());
+            audioWriters[ch] = new AudioWriter(out_file_fds[ch]);
+        }
+        else
+        {
+            fprintf(stderr, "Cannot open %s for output. Aborting\n", channelOutFile.c_str());
+            exitflag = 1;
+            break;
+        }
     }
 
 #ifdef DSD_USE_SERIALDV
     SerialDV::DVController dvController;
     short dvAudioSamples[SerialDV::MBE_AUDIO_BLOCK_SIZE * 8];
 
-    if (!dvSerialDevice.empty())
+    if (!dvSerialDevice.empty() && (exitflag == 0))
     {
         if (dvController.open(dvSerialDevice))
         {
             fprintf(stderr, "SerialDV up. Disable mbelib support\n");
-            dsdDecoder.enableMbelib(false); // de-activate mbelib decoding
+
+            for (int ch = 0; ch < nbChannels; ch++) {
+                decoderPool.getDecoder(ch).enableMbelib(false); // de-activate mbelib decoding
+            }
         }
     }
 #endif
@@ -441,162 +876,190 @@ int main(int argc, char **argv)
     else
     {
         formattext_nsamples = 48000.0f * formattext_refresh;
-        formattext_fp = fopen(formattext_file, "w");
 
-        if (!formattext_fp)
+        for (int ch = 0; ch < nbChannels; ch++)
         {
-            formattext_nsamples = 0;
+            std::string channelFormattextFile = channelFileName(formattext_file, ch, nbChannels);
+            formattext_fps[ch] = fopen(channelFormattextFile.c_str(), "w");
+
+            if (!formattext_fps[ch])
+            {
+                formattext_nsamples = 0;
+            }
         }
     }
 
     int formattext_sample_count = 0;
+    SampleReader sampleReader(in_file_fd, readChunkKiB * 1024, nbChannels);
+
+    if (sampleReader.isMapped()) {
+        fprintf(stderr, "Input is memory mapped\n");
+    }
+
+    if (nbChannels > 1) {
+        fprintf(stderr, "Decoding %d channels with %d threads\n", nbChannels, decoderPool.getNbThreads());
+    }
 
     while (exitflag == 0)
     {
-        short sample;
-        int nbAudioSamples1, nbAudioSamples2;
-        short *audioSamples1, *audioSamples2;
-
-        int result = read(in_file_fd, (void *) &sample, sizeof(short));
+        int nbFrames;
+        const short *samples = sampleReader.read(nbFrames);
 
-        if (result == 0)
+        if (nbFrames == 0)
         {
             fprintf(stderr, "No more input\n");
             break;
         }
 
-        dsdDecoder.run(sample);
-
-#ifdef DSD_USE_SERIALDV
-        if (dvController.isOpen())
+        for (int i = 0; i < nbFrames; i += DSDCCX_DECODE_BLOCK_SAMPLES)
         {
-            if (dsdDecoder.mbeDVReady1())
-            {
-                dvController.decode(dvAudioSamples, (const unsigned char *) dsdDecoder.getMbeDVFrame1(), (SerialDV::DVRate) dsdDecoder.getMbeRate(), dvGain_dB);
+            int blockSize = std::min(nbFrames - i, DSDCCX_DECODE_BLOCK_SAMPLES);
 
-                if (dsdDecoder.upsampling())
-                {
-                    upsamplingEngine.upsample(dsdDecoder.upsampling(), dvAudioSamples, &dvAudioSamples[SerialDV::MBE_AUDIO_BLOCK_SIZE], SerialDV::MBE_AUDIO_BLOCK_SIZE);
-                    result = write(out_file_fd, (const void *) &dvAudioSamples[SerialDV::MBE_AUDIO_BLOCK_SIZE], SerialDV::MBE_AUDIO_BLOCK_BYTES * dsdDecoder.upsampling());
-                }
-                else
-                {
-                    result = write(out_file_fd, (const void *) dvAudioSamples, SerialDV::MBE_AUDIO_BLOCK_BYTES); // TODO: upsampling
-                }
+            decoderPool.runInterleaved(&samples[i * nbChannels], blockSize);
 
-                dsdDecoder.resetMbeDV1();
+            if (formattext_nsamples > 0) {
+                formattext_sample_count += blockSize;
             }
 
-            if (dsdDecoder.mbeDVReady2())
+            for (int ch = 0; ch < nbChannels; ch++)
             {
-                dvController.decode(dvAudioSamples, (const unsigned char *) dsdDecoder.getMbeDVFrame2(), (SerialDV::DVRate) dsdDecoder.getMbeRate(), dvGain_dB);
+                DSDcc::DSDDecoder& dsdDecoder = decoderPool.getDecoder(ch);
+                AudioWriter& audioWriter = *audioWriters[ch];
+                int nbAudioSamples1 = 0, nbAudioSamples2 = 0;
+                short *audioSamples1 = 0, *audioSamples2 = 0;
 
-                if (dsdDecoder.upsampling())
-                {
-                    upsamplingEngine.upsample(dsdDecoder.upsampling(), dvAudioSamples, &dvAudioSamples[SerialDV::MBE_AUDIO_BLOCK_SIZE], SerialDV::MBE_AUDIO_BLOCK_SIZE);
-                    result = write(out_file_fd, (const void *) &dvAudioSamples[SerialDV::MBE_AUDIO_BLOCK_SIZE], SerialDV::MBE_AUDIO_BLOCK_BYTES * dsdDecoder.upsampling());
+                if (dsdDecoder.isMbeAsync()) {
+                    dsdDecoder.synthesizeAudio();
                 }
-                else
+
+#ifdef DSD_USE_SERIALDV
+                if (dvController.isOpen())
                 {
-                    result = write(out_file_fd, (const void *) dvAudioSamples, SerialDV::MBE_AUDIO_BLOCK_BYTES); // TODO: upsampling
-                }
+                    DSDcc::DSDDecoder::DSDDVFrame dvFrames[2][DSD_DVFRAME_QUEUE_SIZE];
+                    int nbDVFrames[2], iFrames[2] = {0, 0};
 
-                dsdDecoder.resetMbeDV2();
-            }
-        }
-        else
-#endif
-        {
-            if (slots & 1)
-            {
-                audioSamples1 = dsdDecoder.getAudio1(nbAudioSamples1);
-            }
+                    for (int slot = 0; slot < 2; slot++) {
+                        nbDVFrames[slot] = dsdDecoder.popDVFrames(slot, dvFrames[slot], DSD_DVFRAME_QUEUE_SIZE);
+                    }
 
-            if (slots & 2)
-            {
-                audioSamples2 = dsdDecoder.getAudio2(nbAudioSamples2);
-            }
+                    while ((iFrames[0] < nbDVFrames[0]) || (iFrames[1] < nbDVFrames[1]))
+                    {
+                        // merge both slots in order of production. Slot 0 first on a tie
+                        int slot = (iFrames[1] == nbDVFrames[1])
+                                || ((iFrames[0] < nbDVFrames[0]) && (dvFrames[0][iFrames[0]].m_timestamp <= dvFrames[1][iFrames[1]].m_timestamp)) ? 0 : 1;
+                        const DSDcc::DSDDecoder::DSDDVFrame& dvFrame = dvFrames[slot][iFrames[slot]++];
 
-            if ((nbAudioSamples1 > 0) && (nbAudioSamples2 == 0))
-            {
-                result = write(out_file_fd, (const void *) audioSamples1, sizeof(short) * nbAudioSamples1);
+                        dvController.decode(dvAudioSamples, (const unsigned char *) dvFrame.m_frame, (SerialDV::DVRate) dvFrame.m_mbeRate, dvGain_dB);
 
-                if (result == -1) {
-                    fprintf(stderr, "Error writing to output\n");
-                } else if (result != sizeof(short) * nbAudioSamples1) {
-                    fprintf(stderr, "Written %d out of %d audio samples\n", result/2, nbAudioSamples1);
+                        if (dsdDecoder.upsampling())
+                        {
+                            upsamplingEngine.upsample(dsdDecoder.upsampling(), dvAudioSamples, &dvAudioSamples[SerialDV::MBE_AUDIO_BLOCK_SIZE], SerialDV::MBE_AUDIO_BLOCK_SIZE);
+                            audioWriter.push(&dvAudioSamples[SerialDV::MBE_AUDIO_BLOCK_SIZE], SerialDV::MBE_AUDIO_BLOCK_SIZE * dsdDecoder.upsampling());
+                        }
+                        else
+                        {
+                            audioWriter.push(dvAudioSamples, SerialDV::MBE_AUDIO_BLOCK_SIZE);
+                        }
+                    }
                 }
+                else
+#endif
+                {
+                    if (slots & 1)
+                    {
+                        audioSamples1 = dsdDecoder.getAudio1(nbAudioSamples1);
+                    }
 
-                dsdDecoder.resetAudio1();
-            }
-
-            if ((nbAudioSamples2 > 0) && (nbAudioSamples1 == 0))
-            {
-                result = write(out_file_fd, (const void *) audioSamples2, sizeof(short) * nbAudioSamples2);
+                    if (slots & 2)
+                    {
+                        audioSamples2 = dsdDecoder.getAudio2(nbAudioSamples2);
+                    }
 
-                if (result == -1) {
-                    fprintf(stderr, "Error writing to output\n");
-                } else if (result != sizeof(short) * nbAudioSamples2) {
-                    fprintf(stderr, "Written %d out of %d audio samples\n", result/2, nbAudioSamples2);
-                }
+                    if ((nbAudioSamples1 > 0) && (nbAudioSamples2 == 0))
+                    {
+                        audioWriter.push(audioSamples1, nbAudioSamples1);
+                        dsdDecoder.resetAudio1();
+                    }
 
-                dsdDecoder.resetAudio2();
-            }
+                    if ((nbAudioSamples2 > 0) && (nbAudioSamples1 == 0))
+                    {
+                        audioWriter.push(audioSamples2, nbAudioSamples2);
+                        dsdDecoder.resetAudio2();
+                    }
 
-            if ((nbAudioSamples1 > 0) && (nbAudioSamples2 > 0))
-            {
-                short *mix;
-                int mixSize;
+                    if ((nbAudioSamples1 > 0) && (nbAudioSamples2 > 0))
+                    {
+                        short *mix;
+                        int mixSize;
 
-                mixer.mix(nbAudioSamples1, nbAudioSamples2, audioSamples1, audioSamples2);
-                mix = mixer.getMix(mixSize);
+                        mixers[ch].mix(nbAudioSamples1, nbAudioSamples2, audioSamples1, audioSamples2);
+                        mix = mixers[ch].getMix(mixSize);
+                        audioWriter.push(mix, mixSize);
 
-                result = write(out_file_fd, (const void *) mix, sizeof(short) * mixSize);
+                        dsdDecoder.resetAudio1();
+                        dsdDecoder.resetAudio2();
+                    }
+                }
 
-                if (result == -1) {
-                    fprintf(stderr, "Error writing to output\n");
-                } else if (result != sizeof(short) * mixSize) {
-                    fprintf(stderr, "Written %d out of %d audio samples\n", result/2, mixSize);
+                if ((formattext_nsamples > 0) && (formattext_sample_count >= formattext_nsamples))
+                {
+                    dsdDecoder.formatStatusText(formattexts[ch]);
+                    fputs(formattexts[ch], formattext_fps[ch]);
+                    putc('\n', formattext_fps[ch]);
                 }
+            }
 
-                dsdDecoder.resetAudio1();
-                dsdDecoder.resetAudio2();
+            if ((formattext_nsamples > 0) && (formattext_sample_count >= formattext_nsamples)) {
+                formattext_sample_count -= formattext_nsamples;
             }
         }
 
-        if (formattext_nsamples > 0)
-        {
-            if (formattext_sample_count < formattext_nsamples)
-            {
-                formattext_sample_count++;
-            }
-            else
-            {
-                dsdDecoder.formatStatusText(formattext);
-                fputs(formattext, formattext_fp);
-                putc('\n', formattext_fp);
-                formattext_sample_count = 0;
-            }
+        for (int ch = 0; ch < nbChannels; ch++) {
+            audioWriters[ch]->flush(); // one write per input chunk
         }
-    }
 
-    if (formattext_fp)
-    {
-        fclose(formattext_fp);
+        if (perfdumpflag)
+        {
+            perfdumpflag = 0;
+            printPerfStats(decoderPool, nbChannels);
+        }
     }
 
     fprintf(stderr, "End of process\n");
 
+    if (DSDcc::DSDDecoder::perfStatsEnabled()) {
+        printPerfStats(decoderPool, nbChannels);
+    }
+
 #ifdef DSD_USE_SERIALDV
     if (dvController.isOpen()) {
         dvController.close();
     }
 #endif
 
-    if ((out_file_fd > -1) && (out_file_fd != STDOUT_FILENO)) {
-        close(out_file_fd);
+    for (int ch = 0; ch < nbChannels; ch++)
+    {
+        if (audioWriters[ch])
+        {
+            audioWriters[ch]->flush();
+            delete audioWriters[ch];
+        }
+
+        if (formattext_fps[ch]) {
+            fclose(formattext_fps[ch]);
+        }
+
+        if ((out_file_fds[ch] > -1) && (out_file_fds[ch] != STDOUT_FILENO)) {
+            close(out_file_fds[ch]);
+        }
     }
 
+    delete[] formattexts;
+    delete[] formattext_fps;
+    delete[] mixers;
+    delete[] audioWriters;
+    delete[] out_file_fds;
+
     if ((in_file_fd > -1) && (in_file_fd != STDIN_FILENO)) {
         close(in_file_fd);
     }
@@ -40,7 +40,7 @@ DSDMBEDecoder::DSDMBEDecoder(DSDDecoder *dsdDecoder) :
     m_aout_max_buf_p = m_aout_max_buf;
     m_aout_max_buf_idx = 0;
 
-    memset(m_audio_out_buf, 0, sizeof(short) * 2 * 48000);
+    m_audio_out_buf = 0;
     m_audio_out_buf_p = m_audio_out_buf;
     m_audio_out_nb_samples = 0;
     m_audio_out_buf_size = 48000; // given in number of unique samples
@@ -53,17 +53,32 @@ DSDMBEDecoder::DSDMBEDecoder(DSDDecoder *dsdDecoder) :
     m_channels = 3; // both channels by default if stereo is set
     m_upsample = 0;
 
+    m_frameQueue = 0;
+    m_nbDroppedFrames = 0;
+    resetErrorCounts();
+
 	initMbeParms();
 }
 
 DSDMBEDecoder::~DSDMBEDecoder()
 {
+    delete m_frameQueue;
+    delete[] m_audio_out_buf;
 #ifdef DSD_USE_MBELIB
     delete m_mbelibParms;
 #endif
 }
 
 void DSDMBEDecoder::initMbeParms()
+{
+    if (m_frameQueue) {
+        queueFrame(MBEFrame::MBEFrameInitParms, 0, 0, 0, 0, 0);
+    } else {
+        initSynthesisParms();
+    }
+}
+
+void DSDMBEDecoder::initSynthesisParms()
 {
 #ifdef DSD_USE_MBELIB
 	mbe_initMbeParms(m_mbelibParms->m_cur_mp, m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced);
@@ -83,87 +98,245 @@ void DSDMBEDecoder::processFrame(char imbe_fr[8][23], char ambe_fr[4][24], char
     if (!m_dsdDecoder->m_mbelibEnable) {
         return;
     }
+
+    if (m_frameQueue)
+    {
+        queueFrame(MBEFrame::MBEFrameVoice, imbe_fr, ambe_fr, imbe7100_fr, 0, 0);
+        return;
+    }
+
+    DSD_PERF_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfMBE); // frames queued for synthesizeQueued are not timed as it may run in another thread
+    synthesizeFrame(m_dsdDecoder->m_mbeRate, m_dsdDecoder->m_opts.uvquality, m_dsdDecoder->m_opts.errorbars == 1,
+            imbe_fr, ambe_fr, imbe7100_fr);
+}
+
+void DSDMBEDecoder::processData(char imbe_data[88], char ambe_data[49])
+{
+    if (!m_dsdDecoder->m_mbelibEnable) {
+        return;
+    }
+
+    if (m_frameQueue)
+    {
+        queueFrame(MBEFrame::MBEFrameData, 0, 0, 0, imbe_data, ambe_data);
+        return;
+    }
+
+    DSD_PERF_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfMBE);
+    synthesizeData(m_dsdDecoder->m_mbeRate, m_dsdDecoder->m_opts.uvquality, m_dsdDecoder->m_opts.errorbars == 1,
+            imbe_data, ambe_data);
+}
+
+void DSDMBEDecoder::setAsync(bool async)
+{
+    if (async && !m_frameQueue)
+    {
+        m_frameQueue = new SPSCQueue<MBEFrame>(m_frameQueueSize);
+    }
+    else if (!async && m_frameQueue)
+    {
+        delete m_frameQueue;
+        m_frameQueue = 0;
+    }
+
+    m_nbDroppedFrames = 0;
+}
+
+void DSDMBEDecoder::resetErrorCounts()
+{
+    __atomic_store_n(&m_nbFrames, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&m_errsTotal, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&m_errs2Total, 0, __ATOMIC_RELAXED);
+}
+
+void DSDMBEDecoder::queueFrame(MBEFrame::MBEFrameType type, char imbe_fr[8][23], char ambe_fr[4][24], char imbe7100_fr[7][24],
+        char imbe_data[88], char ambe_data[49])
+{
+    MBEFrame& frame = m_queuedFrame;
+
+    frame.m_type = type;
+    frame.m_mbeRate = (int) m_dsdDecoder->m_mbeRate;
+    frame.m_uvquality = m_dsdDecoder->m_opts.uvquality;
+    frame.m_errorbars = m_dsdDecoder->m_opts.errorbars == 1;
+
+    // only the frames actually given are copied
+    if (imbe_fr) {
+        memcpy(frame.m_imbe_fr, imbe_fr, sizeof(frame.m_imbe_fr));
+    }
+    if (ambe_fr) {
+        memcpy(frame.m_ambe_fr, ambe_fr, sizeof(frame.m_ambe_fr));
+    }
+    if (imbe7100_fr) {
+        memcpy(frame.m_imbe7100_fr, imbe7100_fr, sizeof(frame.m_imbe7100_fr));
+    }
+    if (imbe_data) {
+        memcpy(frame.m_imbe_data, imbe_data, sizeof(frame.m_imbe_data));
+    }
+    if (ambe_data) {
+        memcpy(frame.m_ambe_data, ambe_data, sizeof(frame.m_ambe_data));
+    }
+
+    if (!m_frameQueue->push(frame)) {
+        m_nbDroppedFrames++;
+    }
+}
+
+int DSDMBEDecoder::synthesizeQueued()
+{
+    if (!m_frameQueue) {
+        return 0;
+    }
+
+    MBEFrame& frame = m_synthesizedFrame;
+    int nbFrames = 0;
+
+    while (m_frameQueue->pop(frame))
+    {
+        if (frame.m_type == MBEFrame::MBEFrameInitParms)
+        {
+            initSynthesisParms();
+            continue;
+        }
+
+        if (frame.m_type == MBEFrame::MBEFrameData) {
+            synthesizeData(frame.m_mbeRate, frame.m_uvquality, frame.m_errorbars, frame.m_imbe_data, frame.m_ambe_data);
+        } else {
+            synthesizeFrame(frame.m_mbeRate, frame.m_uvquality, frame.m_errorbars, frame.m_imbe_fr, frame.m_ambe_fr, frame.m_imbe7100_fr);
+        }
+
+        nbFrames++;
+    }
+
+    return nbFrames;
+}
+
+void DSDMBEDecoder::synthesizeFrame(int mbeRate, int uvquality, bool errorbars,
+        char imbe_fr[8][23], char ambe_fr[4][24], char imbe7100_fr[7][24])
+{
 #ifdef DSD_USE_MBELIB
     memset((void *) imbe_d, 0, 88);
 
-    if (m_dsdDecoder->m_mbeRate == DSDDecoder::DSDMBERate7200x4400)
+    if (mbeRate == DSDDecoder::DSDMBERate7200x4400)
     {
         mbe_processImbe7200x4400Framef(m_audio_out_temp_buf, &m_errs,
                 &m_errs2, m_err_str, imbe_fr, imbe_d, m_mbelibParms->m_cur_mp,
-                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, m_dsdDecoder->m_opts.uvquality);
+                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, uvquality);
     }
-    else if (m_dsdDecoder->m_mbeRate == DSDDecoder::DSDMBERate7100x4400)
+    else if (mbeRate == DSDDecoder::DSDMBERate7100x4400)
     {
         mbe_processImbe7100x4400Framef(m_audio_out_temp_buf, &m_errs,
                 &m_errs2, m_err_str, imbe7100_fr, imbe_d,
                 m_mbelibParms->m_cur_mp, m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced,
-                m_dsdDecoder->m_opts.uvquality);
+                uvquality);
     }
-    else if (m_dsdDecoder->m_mbeRate == DSDDecoder::DSDMBERate3600x2400)
+    else if (mbeRate == DSDDecoder::DSDMBERate3600x2400)
     {
         mbe_processAmbe3600x2400Framef(m_audio_out_temp_buf, &m_errs,
                 &m_errs2, m_err_str, ambe_fr, ambe_d,m_mbelibParms-> m_cur_mp,
-                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, m_dsdDecoder->m_opts.uvquality);
+                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, uvquality);
     }
     else
     {
         mbe_processAmbe3600x2450Framef(m_audio_out_temp_buf, &m_errs,
                 &m_errs2, m_err_str, ambe_fr, ambe_d, m_mbelibParms->m_cur_mp,
-                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, m_dsdDecoder->m_opts.uvquality);
+                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, uvquality);
     }
 
-    if (m_dsdDecoder->m_opts.errorbars == 1)
+    __atomic_fetch_add(&m_nbFrames, 1, __ATOMIC_RELAXED); // read by getQualityStats from the decoder thread
+    __atomic_fetch_add(&m_errsTotal, m_errs, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&m_errs2Total, m_errs2, __ATOMIC_RELAXED);
+
+    if (errorbars)
     {
         m_dsdDecoder->getLogger().log("%s", m_err_str);
     }
 
     processAudio();
+#else
+    (void) mbeRate;
+    (void) uvquality;
+    (void) errorbars;
+    (void) imbe_fr;
+    (void) ambe_fr;
+    (void) imbe7100_fr;
 #endif
 }
 
-void DSDMBEDecoder::processData(char imbe_data[88], char ambe_data[49])
+void DSDMBEDecoder::synthesizeData(int mbeRate, int uvquality, bool errorbars,
+        char imbe_data[88], char ambe_data[49])
 {
-    if (!m_dsdDecoder->m_mbelibEnable) {
-        return;
-    }
 #ifdef DSD_USE_MBELIB
-    if (m_dsdDecoder->m_mbeRate == DSDDecoder::DSDMBERate4400)
+    if (mbeRate == DSDDecoder::DSDMBERate4400)
     {
         mbe_processImbe4400Dataf(m_audio_out_temp_buf, &m_errs,
                 &m_errs2, m_err_str, imbe_data, m_mbelibParms->m_cur_mp,
-                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, m_dsdDecoder->m_opts.uvquality);
+                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, uvquality);
     }
-    else if (m_dsdDecoder->m_mbeRate == DSDDecoder::DSDMBERate2400)
+    else if (mbeRate == DSDDecoder::DSDMBERate2400)
     {
         mbe_processAmbe2400Dataf(m_audio_out_temp_buf, &m_errs,
                 &m_errs2, m_err_str, ambe_data, m_mbelibParms->m_cur_mp,
-                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, m_dsdDecoder->m_opts.uvquality);
+                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, uvquality);
     }
-    else if (m_dsdDecoder->m_mbeRate == DSDDecoder::DSDMBERate2450)
+    else if (mbeRate == DSDDecoder::DSDMBERate2450)
     {
         mbe_processAmbe2450Dataf(m_audio_out_temp_buf, &m_errs,
                 &m_errs2, m_err_str, ambe_data, m_mbelibParms->m_cur_mp,
-                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, m_dsdDecoder->m_opts.uvquality);
+                m_mbelibParms->m_prev_mp, m_mbelibParms->m_prev_mp_enhanced, uvquality);
     }
     else
     {
         return;
     }
 
-    if (m_dsdDecoder->m_opts.errorbars == 1)
+    __atomic_fetch_add(&m_nbFrames, 1, __ATOMIC_RELAXED); // read by getQualityStats from the decoder thread
+    __atomic_fetch_add(&m_errsTotal, m_errs, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&m_errs2Total, m_errs2, __ATOMIC_RELAXED);
+
+    if (errorbars)
     {
         m_dsdDecoder->getLogger().log("%s", m_err_str);
     }
 
     processAudio();
+#else
+    (void) mbeRate;
+    (void) uvquality;
+    (void) errorbars;
+    (void) imbe_data;
+    (void) ambe_data;
 #endif
 }
 
+void DSDMBEDecoder::setAudioBufferSize(int nbSamples)
+{
+    delete[] m_audio_out_buf;
+    m_audio_out_buf = 0;
+
+    if (nbSamples < m_audioBufferMinSize) {
+        nbSamples = m_audioBufferMinSize;
+    }
+
+    m_audio_out_buf_size = nbSamples;
+    resetAudio();
+}
+
+void DSDMBEDecoder::allocateAudio()
+{
+    m_audio_out_buf = new short[2*m_audio_out_buf_size];
+    memset(m_audio_out_buf, 0, sizeof(short) * 2 * m_audio_out_buf_size);
+    resetAudio();
+}
+
 void DSDMBEDecoder::processAudio()
 {
     int i, n;
     float aout_abs, max, gainfactor, gaindelta, maxbuf;
 
+    if (!m_audio_out_buf) {
+        allocateAudio();
+    }
+
     if (m_auto_gain)
     {
         // detect max level
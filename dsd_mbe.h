@@ -18,6 +18,7 @@
 #define DSDCC_DSD_MBE_H_
 
 #include "dsd_filters.h"
+#include "spscqueue.h"
 
 namespace DSDcc
 {
@@ -35,6 +36,23 @@ public:
     void processFrame(char imbe_fr[8][23], char ambe_fr[4][24], char imbe7100_fr[7][24]);
     void processData(char imbe_data[88], char ambe_data[49]);
 
+    /**
+     * In asynchronous mode processFrame and processData only queue the frames and synthesis is
+     * done by synthesizeQueued. This may be called from another thread than the one running the
+     * decoder provided it is the only one calling getAudio and resetAudio.
+     * Set it when the decoder is not running.
+     */
+    void setAsync(bool async);
+    bool getAsync() const { return m_frameQueue != 0; }
+    int synthesizeQueued(); //!< synthesize queued frames. Returns the number of frames synthesized
+    unsigned int getNbDroppedFrames() const { return m_nbDroppedFrames; } //!< frames not queued because the queue was full
+
+    /** Totals of the mbelib error counts of the synthesized frames. Updated atomically by the thread doing the synthesis */
+    unsigned int getNbFrames() const { return __atomic_load_n(&m_nbFrames, __ATOMIC_RELAXED); }
+    unsigned int getErrsTotal() const { return __atomic_load_n(&m_errsTotal, __ATOMIC_RELAXED); }
+    unsigned int getErrs2Total() const { return __atomic_load_n(&m_errs2Total, __ATOMIC_RELAXED); }
+    void resetErrorCounts();
+
     short *getAudio(int& nbSamples)
     {
         nbSamples = m_audio_out_nb_samples;
@@ -47,6 +65,14 @@ public:
         m_audio_out_buf_p = m_audio_out_buf;
     }
 
+    /**
+     * Capacity of the audio output buffer in samples per channel. The buffer is allocated when the first
+     * audio frame is produced and wraps when full so it should hold the audio of one collection period.
+     * Set it when the decoder is not running.
+     */
+    void setAudioBufferSize(int nbSamples);
+    int getAudioBufferSize() const { return m_audio_out_buf_size; }
+
     void setAudioGain(float aout_gain) { m_aout_gain = aout_gain; }
     void setAutoGain(bool auto_gain) { m_auto_gain = auto_gain; }
     void setStereo(bool stereo) { m_stereo = stereo; }
@@ -55,6 +81,35 @@ public:
     int getUpsamplingFactor() const { return m_upsample; }
 
 private:
+    /** copy of a frame and its parameters at the time it was received */
+    struct MBEFrame
+    {
+        enum MBEFrameType
+        {
+            MBEFrameVoice,    //!< from processFrame
+            MBEFrameData,     //!< from processData
+            MBEFrameInitParms //!< initMbeParms call to be done in sequence
+        };
+
+        MBEFrameType m_type;
+        int m_mbeRate;    //!< DSDDecoder::DSDMBERate
+        int m_uvquality;
+        bool m_errorbars;
+        char m_imbe_fr[8][23];
+        char m_ambe_fr[4][24];
+        char m_imbe7100_fr[7][24];
+        char m_imbe_data[88];
+        char m_ambe_data[49];
+    };
+
+    void synthesizeFrame(int mbeRate, int uvquality, bool errorbars,
+            char imbe_fr[8][23], char ambe_fr[4][24], char imbe7100_fr[7][24]);
+    void synthesizeData(int mbeRate, int uvquality, bool errorbars,
+            char imbe_data[88], char ambe_data[49]);
+    void initSynthesisParms();
+    void queueFrame(MBEFrame::MBEFrameType type, char imbe_fr[8][23], char ambe_fr[4][24], char imbe7100_fr[7][24],
+            char imbe_data[88], char ambe_data[49]);
+    void allocateAudio();
     void processAudio();
     void upsample(int upsampling, float invalue);
 
@@ -67,6 +122,9 @@ private:
     int m_errs;
     int m_errs2;
     char m_err_str[64];
+    unsigned int m_nbFrames;   //!< frames synthesized
+    unsigned int m_errsTotal;  //!< sum of m_errs
+    unsigned int m_errs2Total; //!< sum of m_errs2
 
     float m_audio_out_temp_buf[160];   //!< output of decoder
     float *m_audio_out_temp_buf_p;
@@ -78,7 +136,7 @@ private:
     float *m_aout_max_buf_p;
     int m_aout_max_buf_idx;
 
-    short m_audio_out_buf[2*48000];    //!< final result - 1s of L+R S16LE samples
+    short *m_audio_out_buf;            //!< final result - L+R S16LE samples allocated on first use (1s by default)
     short *m_audio_out_buf_p;
     int   m_audio_out_nb_samples;
     int   m_audio_out_buf_size;
@@ -92,6 +150,14 @@ private:
     unsigned char m_channels;  //!< when in stereo output to none (0) or only left (1), right (2) or both (3) channels
 
     DSDMBEAudioInterpolatorFilter m_upsamplingFilter;
+
+    SPSCQueue<MBEFrame> *m_frameQueue; //!< frames waiting for synthesis in asynchronous mode
+    MBEFrame m_queuedFrame;            //!< staging of the frame being queued (decoder side)
+    MBEFrame m_synthesizedFrame;       //!< frame being synthesized (synthesis side)
+    unsigned int m_nbDroppedFrames;
+
+    static const unsigned int m_frameQueueSize = 64; //!< 1.28s of 20ms frames
+    static const int m_audioBufferMinSize = 2*160*7;  //!< two frames upsampled to 48 kS/s
 };
 
 }
@@ -0,0 +1,209 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DSD_PERF_H_
+#define DSD_PERF_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define DSD_PERF_SAMPLING_PERIOD 64 //!< per sample stages are timed once every this number of calls
+
+namespace DSDcc
+{
+
+/**
+ * Time spent and number of calls of the decoder stages. The counters are only updated when the library is
+ * compiled with DSD_USE_PERF_STATS else the timers compile to nothing and all counters stay at zero.
+ * Times are inclusive: a protocol stage includes the FEC, Viterbi, CRC and MBE stages called from it.
+ */
+class DSDPerfStats
+{
+public:
+    typedef enum
+    {
+        DSDPerfMatchedFilter,
+        DSDPerfZeroCrossing,  //!< running min/max, ringing filter and zero crossing detection
+        DSDPerfDigitize,      //!< symbol to dibit decision and levels tracking
+        DSDPerfFrameSync,     //!< sync pattern search and frame processing initialization
+        DSDPerfDMR,
+        DSDPerfDStar,
+        DSDPerfDPMR,
+        DSDPerfYSF,
+        DSDPerfNXDN,
+        DSDPerfFEC,           //!< block codes (Hamming, Golay, QR)
+        DSDPerfViterbi,
+        DSDPerfCRC,
+        DSDPerfMBE,           //!< speech synthesis with mbelib
+        DSDPerfNbStages
+    } DSDPerfStage;
+
+    DSDPerfStats() { reset(); }
+
+    void reset()
+    {
+        memset(m_nanoseconds, 0, sizeof(m_nanoseconds));
+        memset(m_calls, 0, sizeof(m_calls));
+    }
+
+    void add(DSDPerfStage stage, uint64_t nanoseconds)
+    {
+        m_nanoseconds[stage] += nanoseconds;
+        m_calls[stage]++;
+    }
+
+    /** Counts a call of a sampled stage. Returns true if this call is to be timed */
+    bool countSampledCall(DSDPerfStage stage)
+    {
+        return (m_calls[stage]++ % DSD_PERF_SAMPLING_PERIOD) == 0;
+    }
+
+    void addSampledTime(DSDPerfStage stage, uint64_t nanoseconds) //!< time of one call standing for the whole sampling period
+    {
+        m_nanoseconds[stage] += nanoseconds * DSD_PERF_SAMPLING_PERIOD;
+    }
+
+    uint64_t getNanoseconds(DSDPerfStage stage) const { return m_nanoseconds[stage]; }
+    uint64_t getCalls(DSDPerfStage stage) const { return m_calls[stage]; }
+
+    static const char *getStageName(DSDPerfStage stage)
+    {
+        static const char *stageNames[DSDPerfNbStages] = {
+            "matchedFilter", "zeroCrossing", "digitize", "frameSync",
+            "DMR", "DStar", "dPMR", "YSF", "NXDN",
+            "FEC", "Viterbi", "CRC", "MBE"
+        };
+
+        return stageNames[stage];
+    }
+
+    /** One line per stage with calls, total time in ms and mean time per call in ns */
+    void print(FILE *fp) const
+    {
+        fprintf(fp, "%-14s %12s %12s %10s\n", "stage", "calls", "ms", "ns/call");
+
+        for (int stage = 0; stage < DSDPerfNbStages; stage++)
+        {
+            fprintf(fp, "%-14s %12llu %12.3f %10.1f\n",
+                    getStageName((DSDPerfStage) stage),
+                    (unsigned long long) m_calls[stage],
+                    m_nanoseconds[stage] / 1e6,
+                    m_calls[stage] ? (double) m_nanoseconds[stage] / m_calls[stage] : 0.0);
+        }
+    }
+
+    static uint64_t now()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    }
+
+    /** Time between two consecutive clock reads. Subtracted from the timed calls */
+    static uint64_t getClockOverhead()
+    {
+        static uint64_t overhead = measureClockOverhead();
+        return overhead;
+    }
+
+    static uint64_t elapsedSince(uint64_t start)
+    {
+        uint64_t elapsed = now() - start;
+        return elapsed > getClockOverhead() ? elapsed - getClockOverhead() : 0;
+    }
+
+private:
+    static uint64_t measureClockOverhead()
+    {
+        uint64_t minDelta = (uint64_t) -1;
+
+        for (int i = 0; i < 64; i++)
+        {
+            uint64_t start = now();
+            uint64_t delta = now() - start;
+            minDelta = delta < minDelta ? delta : minDelta;
+        }
+
+        return minDelta;
+    }
+
+    uint64_t m_nanoseconds[DSDPerfNbStages];
+    uint64_t m_calls[DSDPerfNbStages];
+};
+
+/** Adds the time between construction and destruction to a stage */
+class DSDPerfTimer
+{
+public:
+    DSDPerfTimer(DSDPerfStats& stats, DSDPerfStats::DSDPerfStage stage) :
+        m_stats(stats),
+        m_stage(stage),
+        m_start(DSDPerfStats::now())
+    {}
+
+    ~DSDPerfTimer()
+    {
+        m_stats.add(m_stage, DSDPerfStats::elapsedSince(m_start));
+    }
+
+private:
+    DSDPerfStats& m_stats;
+    DSDPerfStats::DSDPerfStage m_stage;
+    uint64_t m_start;
+};
+
+/**
+ * Counts every call but only times one in DSD_PERF_SAMPLING_PERIOD. For the stages run for each sample
+ * or symbol where reading the clock twice per call would cost more than the timed work
+ */
+class DSDPerfSampledTimer
+{
+public:
+    DSDPerfSampledTimer(DSDPerfStats& stats, DSDPerfStats::DSDPerfStage stage) :
+        m_stats(stats),
+        m_stage(stage),
+        m_timed(stats.countSampledCall(stage)),
+        m_start(m_timed ? DSDPerfStats::now() : 0)
+    {}
+
+    ~DSDPerfSampledTimer()
+    {
+        if (m_timed) {
+            m_stats.addSampledTime(m_stage, DSDPerfStats::elapsedSince(m_start));
+        }
+    }
+
+private:
+    DSDPerfStats& m_stats;
+    DSDPerfStats::DSDPerfStage m_stage;
+    bool m_timed;
+    uint64_t m_start;
+};
+
+} // namespace DSDcc
+
+/** Times the rest of the enclosing scope. One per scope */
+#ifdef DSD_USE_PERF_STATS
+#define DSD_PERF_TIMER(stats, stage) DSDcc::DSDPerfTimer dsdPerfTimer((stats), (stage))
+#define DSD_PERF_SAMPLED_TIMER(stats, stage) DSDcc::DSDPerfSampledTimer dsdPerfTimer((stats), (stage))
+#else
+#define DSD_PERF_TIMER(stats, stage)
+#define DSD_PERF_SAMPLED_TIMER(stats, stage)
+#endif
+
+#endif /* DSD_PERF_H_ */
@@ -25,17 +25,6 @@ DSDState::DSDState()
 
     repeat = 0;
 
-    for (i = 0; i < 1024; i++)
-    {
-        maxbuf[i] = 15000;
-    }
-
-    for (i = 0; i < 1024; i++)
-    {
-        minbuf[i] = -15000;
-    }
-
-    midx = 0;
     sprintf(fsubtype, "              ");
     sprintf(ftype, "             ");
     symbolcnt = 0;
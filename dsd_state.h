@@ -21,8 +21,6 @@
 #include <stdio.h>
 #include <string.h>
 
-#include "p25p1_heuristics.h"
-
 namespace DSDcc
 {
 
@@ -33,9 +31,6 @@ public:
     ~DSDState();
 
     int repeat;
-    int maxbuf[1024];
-    int minbuf[1024];
-    int midx;
     char fsubtype[16];
     char ftype[16];
     int symbolcnt;
@@ -58,8 +53,6 @@ public:
     char keyid[17];
     int currentslot;
     int p25kid;
-    DSDP25Heuristics::P25Heuristics p25_heuristics;     //!< Heuristics state data for +P5 signals
-    DSDP25Heuristics::P25Heuristics inv_p25_heuristics; //!< Heuristics state data for -P5 signals
 
     short *output_buffer;
     int output_offset;
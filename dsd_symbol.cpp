@@ -29,22 +29,28 @@ const int DSDSymbol::m_zeroCrossingCorrectionProfile2400[11] = { 0, 1, 1, 1, 2,
 const int DSDSymbol::m_zeroCrossingCorrectionProfile4800[11] = { 0, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2}; // base: /2
 const int DSDSymbol::m_zeroCrossingCorrectionProfile9600[11] = { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}; // base: /1
 
-DSDSymbol::DSDSymbol(DSDDecoder *dsdDecoder) :
+DSDSymbol::DSDSymbol(DSDDecoder *dsdDecoder, DSDFilters::DSDFilterArithmetic filterArithmetic) :
         m_dsdDecoder(dsdDecoder),
+        m_dsdFilters(filterArithmetic),
         m_symbol(0),
         m_sampleIndex(0),
         m_noSignal(false),
         m_zeroCrossingSlopeDivisor(232), // for 10 samples per symbol
         m_lmmidx(0),
         m_lmmSamples(10*24),
-		m_ringingFilter(48000.0, 4800.0, 0.99),
+		m_ringingFilter(48000.0, 4800.0, 0.99, filterArithmetic),
 		m_binSymbolBuffer(1024),
+		m_softSymbolBuffer(1024),
 		m_syncSymbolBuffer(64),
-		m_nonInvertedSyncSymbolBuffer(64)
+		m_nonInvertedSyncSymbolBuffer(64),
+		m_syncRegister(0),
+		m_syncRegisterValid(0)
 {
     noCarrier();
     m_umid = 0;
     m_lmid = 0;
+    m_levelTracking = DSDLevelsMinMax;
+    seedCentroids();
     m_nbFSKSymbols = 2;
     m_invertedFSK = false;
     m_samplesPerSymbol = 10;
@@ -88,18 +94,14 @@ void DSDSymbol::resetZeroCrossing()
     m_zeroCrossingPos = 0;
 }
 
-/**
- * Squares the output of the match filter and passes it through a narrow bandpass filter centered on the
- * Symbol rate frequency. Inspired by: http://www.ece.umd.edu/~tretter/commlab/c6713slides/FSKSlides.pdf
- * Non linear clock correction following estimated zero point shift using heuristic table.
- * So far gives the best results.
- */
 bool DSDSymbol::pushSample(short sample)
 {
     // matched filter
 
     if (m_dsdDecoder->m_opts.use_cosine_filter)
     {
+        DSD_PERF_SAMPLED_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfMatchedFilter);
+
         if (m_samplesPerSymbol == 20) {
             sample = m_dsdFilters.nxdn_filter(sample); // 6.25 kHz for 2400 baud
         } else {
@@ -107,10 +109,44 @@ bool DSDSymbol::pushSample(short sample)
         }
     }
 
+    return pushFilteredSample(sample);
+}
+
+/**
+ * Matched filter over a block of samples. The filter state only depends on the data rate and cosine filter
+ * options so the whole block can be filtered before the symbols are recovered with pushFilteredSample.
+ */
+void DSDSymbol::filterBlock(const short *samples, short *filteredSamples, int nbSamples)
+{
+    DSD_PERF_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfMatchedFilter);
+
+    if (m_dsdDecoder->m_opts.use_cosine_filter)
+    {
+        if (m_samplesPerSymbol == 20) {
+            m_dsdFilters.nxdn_filter(samples, filteredSamples, nbSamples); // 6.25 kHz for 2400 baud
+        } else {
+            m_dsdFilters.dmr_filter(samples, filteredSamples, nbSamples);  // 12.5 kHz for 4800 and 9600 baud
+        }
+    }
+    else
+    {
+        memcpy(filteredSamples, samples, nbSamples * sizeof(short));
+    }
+}
+
+/**
+ * Squares the output of the match filter and passes it through a narrow bandpass filter centered on the
+ * Symbol rate frequency. Inspired by: http://www.ece.umd.edu/~tretter/commlab/c6713slides/FSKSlides.pdf
+ * Non linear clock correction following estimated zero point shift using heuristic table.
+ * So far gives the best results.
+ */
+bool DSDSymbol::pushFilteredSample(short sample)
+{
     m_filteredSample = sample;
 
     if (!m_noSignal)
     {
+        DSD_PERF_SAMPLED_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfZeroCrossing);
         m_lmmSamples.update(sample); // store for running min/max calculation
 
         // ringing filter
@@ -255,10 +291,59 @@ void DSDSymbol::snapMinMax()
 {
     m_max = m_max + (m_lmmSamples.max() - m_max) / 4; // alpha = 0.25
     m_min = m_min + (m_lmmSamples.min() - m_min) / 4; // alpha = 0.25
+
+    if (centroidsLocked()) {
+        return; // thresholds follow the centroids
+    }
+
     // recalibrate center/umid/lmid
     m_center = ((m_max) + (m_min)) / 2;
     m_umid = (((m_max) - m_center) / 2) + m_center;
     m_lmid = (((m_min) - m_center) / 2) + m_center;
+    seedCentroids();
+}
+
+/**
+ * Start the centroids in the middle of the decision regions of the min/max thresholds so that the
+ * thresholds do not move when the tracking takes over at frame sync.
+ */
+void DSDSymbol::seedCentroids()
+{
+    m_centroids[0] = (m_min + m_lmid) / 2;
+    m_centroids[1] = (m_lmid + m_center) / 2;
+    m_centroids[2] = (m_center + m_umid) / 2;
+    m_centroids[3] = (m_umid + m_max) / 2;
+}
+
+/**
+ * Decision directed level tracking: the symbol pulls the centroid of the level it has been decided
+ * at and the thresholds are placed midway between adjacent centroids. A spike moves only one centroid
+ * by a sixteenth of its distance.
+ */
+void DSDSymbol::trackCentroids()
+{
+    int level;
+
+    if (m_nbFSKSymbols == 4) {
+        level = (m_symbol >= m_lmid) + (m_symbol > m_center) + (m_symbol > m_umid); // same regions as digitize
+    } else {
+        level = m_symbol > m_center ? 3 : 0;
+    }
+
+    m_centroids[level] += (m_symbol - m_centroids[level]) / 16;
+
+    if (m_nbFSKSymbols == 4)
+    {
+        m_lmid = (m_centroids[0] + m_centroids[1]) / 2;
+        m_center = (m_centroids[1] + m_centroids[2]) / 2;
+        m_umid = (m_centroids[2] + m_centroids[3]) / 2;
+    }
+    else
+    {
+        m_center = (m_centroids[0] + m_centroids[3]) / 2;
+        m_umid = (m_center + m_centroids[3]) / 2;
+        m_lmid = (m_center + m_centroids[0]) / 2;
+    }
 }
 
 void DSDSymbol::setFSK(unsigned int nbSymbols, bool inverted)
@@ -374,13 +459,75 @@ unsigned char DSDSymbol::digitize(int symbol)
 	}
 }
 
+/**
+ * Soft counterpart of digitize. Each bit gets a confidence from the distance of the symbol to the
+ * threshold that decides it, in units of the distance between the center and the mid levels.
+ * The hard decision (soft value >> 3) is always the same as with digitize.
+ */
+DSDSymbol::DSDSoftDibit DSDSymbol::digitizeSoft(int symbol)
+{
+    DSDSoftDibit softDibit;
+    int scale = symbol > m_center ? m_umid - m_center : m_center - m_lmid;
+
+    if (m_nbFSKSymbols == 2)
+    {
+        softDibit.m_msb = 0;
+        softDibit.m_lsb = softBit(m_invertedFSK ? symbol - m_center : m_center - symbol + 1, scale);
+    }
+    else if (m_nbFSKSymbols == 4)
+    {
+        softDibit.m_msb = softBit(m_invertedFSK ? symbol - m_center : m_center - symbol + 1, scale); // negative for 2 and 3
+        softDibit.m_lsb = softBit(symbol > m_center ? symbol - m_umid : m_lmid - symbol, scale);    // outer for 1 and 3
+    }
+    else // invalid
+    {
+        softDibit.m_msb = 0;
+        softDibit.m_lsb = 0;
+    }
+
+    return softDibit;
+}
+
+/** distance > 0 decides a 1 and distance <= 0 a 0. Confidence saturates at a distance of scale */
+unsigned char DSDSymbol::softBit(int distance, int scale)
+{
+    if (scale <= 0) {
+        scale = 1;
+    }
+
+    if (distance > 0)
+    {
+        int k = ((distance - 1) * 8) / scale;
+        return 8 + (k > 7 ? 7 : k);
+    }
+    else
+    {
+        int k = (-distance * 8) / scale;
+        return 7 - (k > 7 ? 7 : k);
+    }
+}
+
 void DSDSymbol::digitizeIntoBinaryBuffer()
 {
+    DSD_PERF_SAMPLED_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfDigitize);
+
     // determine dibit state
     unsigned char binSymbol = digitize(m_symbol);
     m_binSymbolBuffer.push(binSymbol);
+    m_softSymbolBuffer.push(digitizeSoft(m_symbol));
     m_syncSymbolBuffer.push(m_symbol > 0 ? 1 : 3);
+    m_syncRegister = (m_syncRegister << 1) | (m_symbol > 0 ? 0 : 1);
+    m_syncRegisterValid = (m_syncRegisterValid << 1) | 1;
     m_nonInvertedSyncSymbolBuffer.push((m_invertedFSK ? (m_symbol <= 0) : (m_symbol > 0)) ? 1 : 3);
+
+    if (centroidsLocked()) {
+        trackCentroids();
+    }
+}
+
+bool DSDSymbol::centroidsLocked() const
+{
+    return (m_levelTracking == DSDLevelsCentroids) && (m_dsdDecoder->m_fsmState != DSDDecoder::DSDLookForSync);
 }
 
 int DSDSymbol::invert_dibit(int dibit)
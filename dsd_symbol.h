@@ -17,10 +17,13 @@
 #ifndef DSD_SYMBOL_H_
 #define DSD_SYMBOL_H_
 
+#include <stdint.h>
 #include "dsd_filters.h"
 #include "doublebuffer.h"
 #include "runningmaxmin.h"
 
+#define DSD_SOFT_BIT_MAX 15 // soft bits range from 0 (certain 0) to 15 (certain 1). Hard decision is the most significant of the 4 bits
+
 namespace DSDcc
 {
 
@@ -29,7 +32,21 @@ class DSDDecoder;
 class DSDSymbol
 {
 public:
-    DSDSymbol(DSDDecoder *dsdDecoder);
+    /** Soft decision on the two bits of a dibit. With 2FSK the bit is in m_lsb and m_msb is 0 */
+    struct DSDSoftDibit
+    {
+        unsigned char m_msb; //!< soft value of the most significant bit (0..DSD_SOFT_BIT_MAX)
+        unsigned char m_lsb; //!< soft value of the least significant bit (0..DSD_SOFT_BIT_MAX)
+    };
+
+    /** How the decision thresholds between the symbol levels are obtained */
+    typedef enum
+    {
+        DSDLevelsMinMax,   //!< from the running min and max of the samples (default)
+        DSDLevelsCentroids //!< midway between the running means of the symbols decided at each level once in sync
+    } DSDLevelTracking;
+
+    DSDSymbol(DSDDecoder *dsdDecoder, DSDFilters::DSDFilterArithmetic filterArithmetic = DSDFilters::DSDFilterFloat);
     ~DSDSymbol();
 
     void noCarrier();
@@ -39,13 +56,21 @@ public:
     void setSamplesPerSymbol(int samplesPerSymbol);
     void setFSK(unsigned int nbSymbols, bool inverted=false);
     void setNoSignal(bool noSignal) { m_noSignal = noSignal; }
+    void setLevelTracking(DSDLevelTracking levelTracking) { m_levelTracking = levelTracking; }
+    DSDLevelTracking getLevelTracking() const { return m_levelTracking; }
     bool pushSample(short sample); //!< push a new sample into the decoder. Returns true if a new symbol is available
+    bool pushFilteredSample(short sample); //!< same as pushSample but the sample has already been through the matched filter
+    void filterBlock(const short *samples, short *filteredSamples, int nbSamples); //!< run the matched filter over a block of samples
 
     int getSymbol() const { return m_symbol; }
     int getDibit(); //!< from the last retrieved symbol Returns either the bit (0,1) or the dibit value (0,1,2,3)
     unsigned char *getDibitBack(unsigned int shift) { return m_binSymbolBuffer.getBack(shift); }
+    DSDSoftDibit getSoftDibit() { return m_softSymbolBuffer.getLatest(); } //!< soft version of getDibit()
+    DSDSoftDibit *getSoftDibitBack(unsigned int shift) { return m_softSymbolBuffer.getBack(shift); } //!< soft version of getDibitBack()
     unsigned char *getSyncDibitBack(unsigned int shift) { return m_syncSymbolBuffer.getBack(shift); }
     unsigned char *getNonInvertedSyncDibitBack(unsigned int shift) { return m_nonInvertedSyncSymbolBuffer.getBack(shift); }
+    uint64_t getSyncRegister() const { return m_syncRegister; }           //!< last 64 sync symbols one bit each (see m_syncRegister)
+    uint64_t getSyncRegisterValid() const { return m_syncRegisterValid; } //!< bits of the sync register filled since start
 
     static int invert_dibit(int dibit);
     int getLevel() const { return (m_max - m_min) / 328; }
@@ -77,8 +102,13 @@ private:
     int get_dibit();
 //    void use_symbol(int symbol);
     unsigned char digitize(int symbol);
+    DSDSoftDibit digitizeSoft(int symbol);
+    static unsigned char softBit(int distance, int scale);
     void digitizeIntoBinaryBuffer();
     void snapMinMax();
+    void seedCentroids();
+    void trackCentroids();
+    bool centroidsLocked() const; //!< centroid tracking selected and a frame sync has been found
     static int comp(const void *a, const void *b);
     static int compShort(const void *a, const void *b);
 
@@ -102,6 +132,8 @@ private:
     int m_min, m_max;
     int m_center;
     int m_umid, m_lmid;
+    DSDLevelTracking m_levelTracking;
+    int m_centroids[4];            //!< running means of the symbols of each level from lowest to highest. 2FSK uses the outer ones
     int m_numflips;
     int m_symbolSyncQuality;
     int m_symbolSyncQualityCounter;
@@ -111,11 +143,14 @@ private:
     unsigned int m_nbFSKSymbols;
     bool m_invertedFSK;
     int  m_samplesPerSymbol;
-    lemiremaxmintruestreaming<short> m_lmmSamples;    //!< running min/max calculator
+    lemiremaxmintruestreaming<short, 512> m_lmmSamples; //!< running min/max calculator (window up to 20*24 samples)
     DSDSecondOrderRecursiveFilter m_ringingFilter;
     DoubleBuffer<unsigned char> m_binSymbolBuffer;    //!< digitized symbol
+    DoubleBuffer<DSDSoftDibit> m_softSymbolBuffer;    //!< soft digitized symbol in sync with m_binSymbolBuffer
     DoubleBuffer<unsigned char> m_syncSymbolBuffer;   //!< symbol digitized for synchronization: positive is 1, negative is 3
     DoubleBuffer<unsigned char> m_nonInvertedSyncSymbolBuffer; //!< same but resetting to positive sync
+    uint64_t m_syncRegister;      //!< sync symbols packed as bits: 0 for positive (1), 1 for negative (3). Last symbol in LSB
+    uint64_t m_syncRegisterValid; //!< one bit set per symbol shifted in the sync register
 
     static const int m_zeroCrossingCorrectionProfile2400[11];
     static const int m_zeroCrossingCorrectionProfile4800[11];
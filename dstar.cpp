@@ -137,8 +137,7 @@ DSDDstar::DSDDstar(DSDDecoder *dsdDecoder) :
 		m_dsdDecoder(dsdDecoder),
 		m_voiceFrameCount(0),
 		m_frameType(DStarVoiceFrame),
-		m_viterbi(2, Viterbi::Poly23a, false),
-		m_crc(CRC::PolyDStar16, 16, 0xffff, 0xffff, 1, 0, 0)
+		m_viterbi(Viterbi::Poly23a, false, 330)
 {
     reset_header_strings();
     m_slowData.init();
@@ -228,8 +227,8 @@ void DSDDstar::processVoice()
             m_dsdDecoder->getLogger().log("\nMBE: ");
         }
 
+        m_dsdDecoder->pushDVFrame(0); // Indicate that a DVSI frame is available
         m_dsdDecoder->m_mbeDecoder1.processFrame(0, m_dsdDecoder->ambe_fr, 0);
-        m_dsdDecoder->m_mbeDVReady1 = true; // Indicate that a DVSI frame is available
 
         m_symbolIndex = 0;
 
@@ -412,7 +411,7 @@ void DSDDstar::processSlowDataGroup()
     case DStarSlowDataHeader:
         if (m_slowData.radioHeaderIndex == 41) // last byte
         {
-            if (m_crcDStar.check_crc((unsigned char *) m_slowData.radioHeader, 41))
+            if (checkHeaderCRC((unsigned char *) m_slowData.radioHeader))
         	{
 //                std::cerr << "DSDDstar::processSlowDataGroup: DStarSlowDataHeader OK" << std::endl;
                 m_header.setRpt2((const char *) &m_slowData.radioHeader[3], false);
@@ -496,6 +495,14 @@ void DSDDstar::processHD()
     }
 }
 
+bool DSDDstar::checkHeaderCRC(unsigned char *header)
+{
+    DSD_PERF_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfCRC);
+    bool ok = m_crcDStar.check_crc(header, 41);
+    m_dsdDecoder->countCheck(DSDDecoder::DSDCheckDStarHeaderCRC, ok);
+    return ok;
+}
+
 void DSDDstar::dstar_header_decode()
 {
     unsigned char radioheaderbuffer2[660];
@@ -504,10 +511,16 @@ void DSDDstar::dstar_header_decode()
     int octetcount, bitcount, loop;
     unsigned char bit2octet[] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
 
-    Descramble::scramble(m_dsdDecoder->m_dsdSymbol.getDibitBack(660), radioheaderbuffer2);
+    DSDSymbol::DSDSoftDibit *softBits = m_dsdDecoder->m_dsdSymbol.getSoftDibitBack(660);
+
+    for (loop = 0; loop < 660; loop++) {
+        radioheaderbuffer3[loop] = softBits[loop].m_lsb; // GMSK symbols carry one bit
+    }
+
+    Descramble::scrambleSoft(radioheaderbuffer3, radioheaderbuffer2, DSD_SOFT_BIT_MAX);
     Descramble::deinterleave(radioheaderbuffer2, radioheaderbuffer3);
-//    Descramble::FECdecoder(radioheaderbuffer3, radioheaderbuffer2);
-    m_viterbi.decodeFromBits(radioheaderbuffer2, radioheaderbuffer3, 660, 0);
+//    Descramble::FECdecoder(m_viterbi, radioheaderbuffer3, radioheaderbuffer2);
+    m_dsdDecoder->decodeViterbi(m_viterbi, radioheaderbuffer2, radioheaderbuffer3, 660);
     memset(radioheader, 0, 41);
 
     // note we receive 330 bits, but we only use 328 of them (41 octets)
@@ -532,6 +545,7 @@ void DSDDstar::dstar_header_decode()
         }
     }
 
+    checkHeaderCRC(radioheader); // only counted as the header is used anyway
     m_dsdDecoder->getLogger().log("\nDSTAR HEADER: ");
 
     m_header.setRpt2((const char *) &radioheader[3], true);
@@ -187,6 +187,7 @@ private:
    void processSync();
 
    void dstar_header_decode();
+   bool checkHeaderCRC(unsigned char *header); //!< 41 bytes header with its CRC
    void reset_header_strings();
 
    void storeSymbolDV(int bitindex, unsigned char bit, bool lsbFirst = true);
@@ -196,9 +197,8 @@ private:
    DStarFrameTYpe m_frameType;
    int m_symbolIndex;    //!< Current symbol index in non HD sequence
    int m_symbolIndexHD;  //!< Current symbol index in HD sequence
-   Viterbi3 m_viterbi;
+   Viterbi3 m_viterbi;   //!< path memory reserved for the 330 symbols of the header
    DStarCRC m_crcDStar;
-   CRC m_crc;
 
    // DSTAR
    unsigned char nullBytes[4];
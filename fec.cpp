@@ -34,15 +34,19 @@ const unsigned char Hamming_7_4::m_H[7*3] = {
 //      0  1  2  3 <- correctable bit positions
 };
 
-void Hamming_7_4::init()
-{
-    // correctable bit positions given syndrome bits as index (see above)
-    memset(m_corr, 0xFF, 8); // initialize with all invalid positions
-    m_corr[0b101] = 0;
-    m_corr[0b111] = 1;
-    m_corr[0b110] = 2;
-    m_corr[0b011] = 3;
-}
+// correctable bit position given syndrome bits as index (see above). 0xFF: not correctable
+const unsigned char Hamming_7_4::m_corr[8] = {
+        0xFF, 0xFF, 0xFF,    3, 0xFF,    0,    2,    1
+};
+
+// rows of m_G and m_H as codewords packed MSB first for the word based methods
+const uint32_t Hamming_7_4::m_Gw[4] = {
+        0x45, 0x27, 0x16, 0x0B
+};
+
+const uint32_t Hamming_7_4::m_Hw[3] = {
+        0x74, 0x3A, 0x69
+};
 
 // ========================================================================================
 
@@ -65,19 +69,20 @@ const unsigned char Hamming_12_8::m_H[12*4] = {
 //      0  1  2  3  4  5  6  7 <- correctable bit positions
 };
 
-void Hamming_12_8::init()
-{
-    // correctable bit positions given syndrome bits as index (see above)
-    memset(m_corr, 0xFF, 16); // initialize with all invalid positions
-    m_corr[0b1110] = 0;
-    m_corr[0b0111] = 1;
-    m_corr[0b1010] = 2;
-    m_corr[0b0101] = 3;
-    m_corr[0b1011] = 4;
-    m_corr[0b1100] = 5;
-    m_corr[0b0110] = 6;
-    m_corr[0b0011] = 7;
-}
+// correctable bit position given syndrome bits as index (see above). 0xFF: not correctable
+const unsigned char Hamming_12_8::m_corr[16] = {
+        0xFF, 0xFF, 0xFF,    7, 0xFF,    3,    6,    1,
+        0xFF, 0xFF,    2,    4,    5, 0xFF,    0, 0xFF
+};
+
+// rows of m_G and m_H as codewords packed MSB first for the word based methods
+const uint32_t Hamming_12_8::m_Gw[8] = {
+        0x80E, 0x407, 0x20A, 0x105, 0x08B, 0x04C, 0x026, 0x013
+};
+
+const uint32_t Hamming_12_8::m_Hw[4] = {
+        0xAC8, 0xD64, 0xEB2, 0x591
+};
 
 // ========================================================================================
 
@@ -104,22 +109,21 @@ const unsigned char Hamming_15_11::m_H[15*4] = {
 //      0  1  2  3  4  5  6  7  8  9 10  <- correctable bit positions
 };
 
-void Hamming_15_11::init()
-{
-    // correctable bit positions given syndrome bits as index (see above)
-    memset(m_corr, 0xFF, 16); // initialize with all invalid positions
-    m_corr[0b1001] = 0;
-    m_corr[0b1101] = 1;
-    m_corr[0b1111] = 2;
-    m_corr[0b1110] = 3;
-    m_corr[0b0111] = 4;
-    m_corr[0b1010] = 5;
-    m_corr[0b0101] = 6;
-    m_corr[0b1011] = 7;
-    m_corr[0b1100] = 8;
-    m_corr[0b0110] = 9;
-    m_corr[0b0011] = 10;
-}
+// correctable bit position given syndrome bits as index (see above). 0xFF: not correctable
+const unsigned char Hamming_15_11::m_corr[16] = {
+        0xFF, 0xFF, 0xFF,   10, 0xFF,    6,    9,    4,
+        0xFF,    0,    5,    7,    8,    1,    3,    2
+};
+
+// rows of m_G and m_H as codewords packed MSB first for the word based methods
+const uint32_t Hamming_15_11::m_Gw[11] = {
+        0x4009, 0x200D, 0x100F, 0x080E, 0x0407, 0x020A, 0x0105, 0x008B,
+        0x004C, 0x0026, 0x0013
+};
+
+const uint32_t Hamming_15_11::m_Hw[4] = {
+        0x7AC8, 0x3D64, 0x1EB2, 0x7591
+};
 
 // ========================================================================================
 
@@ -145,22 +149,23 @@ const unsigned char Hamming_16_11_4::m_H[16*5] = {
         1, 0, 1, 0, 0, 1, 1, 0, 1, 1, 1,   0, 0, 0, 0, 1
 };
 
-void Hamming_16_11_4::init()
-{
-    // correctable bit positions given syndrome bits as index (see above)
-    memset(m_corr, 0xFF, 32); // initialize with all invalid positions
-    m_corr[0b10011] = 0;
-    m_corr[0b11010] = 1;
-    m_corr[0b11111] = 2;
-    m_corr[0b11100] = 3;
-    m_corr[0b01110] = 4;
-    m_corr[0b10101] = 5;
-    m_corr[0b01011] = 6;
-    m_corr[0b10110] = 7;
-    m_corr[0b11001] = 8;
-    m_corr[0b01101] = 9;
-    m_corr[0b00111] = 10;
-}
+// correctable bit position given syndrome bits as index (see above). 0xFF: not correctable
+const unsigned char Hamming_16_11_4::m_corr[32] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,   10,
+        0xFF, 0xFF, 0xFF,    6, 0xFF,    9,    4, 0xFF,
+        0xFF, 0xFF, 0xFF,    0, 0xFF,    5,    7, 0xFF,
+        0xFF,    8,    1, 0xFF,    3, 0xFF, 0xFF,    2
+};
+
+// rows of m_G and m_H as codewords packed MSB first for the word based methods
+const uint32_t Hamming_16_11_4::m_Gw[11] = {
+        0x8013, 0x401A, 0x201F, 0x101C, 0x080E, 0x0415, 0x020B, 0x0116,
+        0x0099, 0x004D, 0x0027
+};
+
+const uint32_t Hamming_16_11_4::m_Hw[5] = {
+        0xF590, 0x7AC8, 0x3D64, 0xEB22, 0xA6E1
+};
 
 // ========================================================================================
 
@@ -190,6 +195,533 @@ const unsigned char Golay_20_8::m_H[20*12] = {
         0, 1, 1, 1, 0, 1, 0, 1,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
 };
 
+// positions of the bits to flip with the syndrome as index for all error patterns of up to 3 bits.
+// Syndromes are computed with m_H. 255 ends the list.
+const unsigned char Golay_20_8::m_corr[4096][3] = {
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  5,  6}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  3,  5,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  5}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,  7}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  7,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  6,  7},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  6}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  2,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  7,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  3,  4}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  4}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  5,  6,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  7},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,  4,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  4,  5}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  3,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  4,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  6,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  5,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  5}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  4,  6,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  7,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5,  6}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  7,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  3,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  3,  7}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,  4,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  2,  3}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  2,  4}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  1,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  4,  7},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  5,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  4,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  4,  5,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  6}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  4,  6},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  3,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  3}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  7}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  4}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  2}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  7}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  2,  4}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  7,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  4,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  3,  5,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  3,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  6,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  4,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  6,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  7,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  5,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  7,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  4,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  2,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  5,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  6}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  3}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  3,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  4}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,  7}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  4,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  7,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  5,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  5,  6},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  4,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  3,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  5}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  2,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  4,  5,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  5,  7}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  6,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}
+};
+
+// rows of m_G and m_H as codewords packed MSB first for the word based methods
+const uint32_t Golay_20_8::m_Gw[8] = {
+        0x803DA, 0x40D99, 0x206CD, 0x10367, 0x08DC6, 0x04A97, 0x0293E, 0x018EB
+};
+
+const uint32_t Golay_20_8::m_Hw[12] = {
+        0x4F800, 0x68400, 0xB4200, 0xDA100, 0xED080, 0xB9040, 0x13020, 0xC6010,
+        0xE3008, 0x3E004, 0x9F002, 0x75001
+};
+
 // ========================================================================================
 
 const unsigned char Golay_23_12::m_G[23*12] = {
@@ -221,6 +753,278 @@ const unsigned char Golay_23_12::m_H[23*11] = {
         0, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1,   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
 };
 
+// positions of the bits to flip with the syndrome as index for all error patterns of up to 3 bits.
+// Syndromes are computed with m_H. 255 ends the list.
+const unsigned char Golay_23_12::m_corr[2048][3] = {
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  6,  9},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  8,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2, 10}, {255,255,255},
+        {255,255,255}, {  4,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,  7}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  6, 10}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  5,  9}, {  4,  7,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,  4}, {255,255,255}, {255,255,255}, {255,255,255}, {  7,  9, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  6,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  5}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  5,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  8,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  4,  8}, {255,255,255}, {  3,  6,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  3,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5,  7}, {255,255,255}, {255,255,255}, {  6,  8,  9}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  8,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  5,  6,  9}, {255,255,255}, {255,255,255}, {  2,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  3, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  6,  7},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  6,  8, 10}, {  0,  4,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  3,  4}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  4,  8}, {  5,  6, 10}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,  7}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  5, 10}, {255,255,255},
+        {255,255,255}, {  3,  4,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  8,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  8, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  3,  7}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,  5,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  5, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  6}, {255,255,255},
+        {255,255,255}, {  2,  6,  9}, {255,255,255}, {255,255,255}, {  5,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  8, 10}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  7,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  1, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  4,  5,  8}, {  0,  6, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  9, 10,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  2,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  9, 10}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  7,  8,  9}, {255,255,255}, {255,255,255}, {  2,  5,  6}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  6,  8}, {255,255,255}, {255,255,255}, {  5,  7,  9}, {255,255,255}, {255,255,255}, {  3,  4,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  8,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  2,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  5, 10,255}, {  0,  2,  3}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  5}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  7,255}, {  4,  5,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  8, 10,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  4,  6,255}, {255,255,255}, {  2,  3,  8}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  2}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  4,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  3,  5}, {255,255,255}, {255,255,255}, {  0, 10,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  7,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  6,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  7,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4, 10}, {255,255,255},
+        {255,255,255}, {  1,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  7,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  2,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  4,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  9,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  4,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  7, 10}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2, 10,255}, {  0,  3,  5}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  5,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  4,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  4, 10}, {  5,  6,  8}, {255,255,255}, {255,255,255}, {  2,  7,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  9,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  4,  7}, {255,255,255}, {255,255,255}, {  5,  9,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  5,  6}, {  4,  8, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  3,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  8,  9,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  5, 10}, {  0,  6,  8},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  7,  8, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  5,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  5,  8}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  4}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  5,  6,  7}, {255,255,255}, {255,255,255}, {  2,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  3,  6, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5,  9}, {255,255,255}, {255,255,255}, {  6,  7,  8}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  5}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  8, 10}, {  4,  5,  6},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  7,  8}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  3, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  5,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  4,  6,  8}, {  0,  5, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  7}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, { 10,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  5,  7}, {  4,  9,255}, {255,255,255},
+        {255,255,255}, {  1,  2,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  5,  8, 10}, {  0,  4,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  4,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  1,  4}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  6,255}, {255,255,255}, {  3,  4,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  6, 10}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  6,  7},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  7,  9,255}, {255,255,255}, {255,255,255}, {  3,  4,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  2, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  7,  9}, {  3,  5,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  2,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  7, 10,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  6,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  8,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  6},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  4}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  9,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  6,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  6,  7}, {255,255,255}, {255,255,255}, {  5,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  4, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  4}, {255,255,255}, {  6,  8,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  3,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  5,  6,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,  8, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  5,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  7}, {255,255,255}, {255,255,255},
+        {  0,  3,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  6,  9},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  8,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  7,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  3,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  6, 10}, {  0,  5,  8}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  3,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  9,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  1,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  6,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  9,255}, {255,255,255},
+        {255,255,255}, {  2,  4,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  6,  8},
+        {  2,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  4,  7}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4, 10},
+        {  3,  5,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  6}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  9,255}, {  4,  5,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  6,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  3,  4, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  5,  6},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  7,  8}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  8,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  7, 10}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  3}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,  3,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  8,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  5,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  4,  5,255}, {  3,  7,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  8,  9, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  2,  5}, {255,255,255}, {255,255,255}, {  3, 10,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  7,  8,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,  8}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  3}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  4,  9}, {255,255,255}, {255,255,255}, {  5,  7,255},
+        {255,255,255}, {255,255,255}, {  1, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  7,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5,  8}, {255,255,255}, {255,255,255}, {  6,  7,  9}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  4,  6,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  6},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  4,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  7,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  4,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  9, 10}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  6, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}
+};
+
+// rows of m_G and m_H as codewords packed MSB first for the word based methods
+const uint32_t Golay_23_12::m_Gw[12] = {
+        0x40063A, 0x20031D, 0x1007B4, 0x0803DA, 0x0401ED, 0x0206CC, 0x010366, 0x0081B3,
+        0x0046E3, 0x00254B, 0x00149F, 0x000C75
+};
+
+const uint32_t Golay_23_12::m_Hw[11] = {
+        0x527C00, 0x7B4200, 0x3DA100, 0x1ED080, 0x0F6840, 0x55C820, 0x789810, 0x6E3008,
+        0x371804, 0x49F002, 0x24F801
+};
+
 // ========================================================================================
 
 const unsigned char Golay_24_12::m_G[24*12] = {
@@ -253,6 +1057,534 @@ const unsigned char Golay_24_12::m_H[24*12] = {
         1, 1, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1,   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
 };
 
+// positions of the bits to flip with the syndrome as index for all error patterns of up to 3 bits.
+// Syndromes are computed with m_H. 255 ends the list.
+const unsigned char Golay_24_12::m_corr[4096][3] = {
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  6,  9},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3, 11},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  8,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2, 10}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  4,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  2,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  6, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,  5,  9}, {255,255,255}, {255,255,255}, {  4,  7,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,  4},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  7,  9, 10}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  1,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  8,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  6,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  7,  9, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  5,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  6, 11}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  9}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  6,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  3,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5,  7}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  9, 11}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  8,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  2, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  5,  6,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, { 10, 11,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  3, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4, 10, 11},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  6,  7}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  8, 10}, {  0,  4,  5}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  6, 11}, {255,255,255}, {  1,  3,  4}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  4,  8}, {  5,  6, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  9, 11,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  8, 11}, {255,255,255}, {255,255,255}, {  1,  5, 10}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  3,  4,  6}, {255,255,255}, {  0,  1, 11}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  8,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  7, 10, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  8, 10}, {255,255,255}, {255,255,255}, {  3,  5, 11}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  3,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  5,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  3,  5, 10}, {255,255,255}, {255,255,255}, {  1,  8, 11}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  3, 11}, {255,255,255}, {  1,  4,  6}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  6,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  5,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  5, 11}, {255,255,255}, {255,255,255}, {  3,  8, 10}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  7,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  1, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  5,  8}, {  0,  6, 10}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  9, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  6, 11},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  4,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  6,  8, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  9, 10}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  7,  8,  9}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5,  6}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  9, 11},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  4, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  6,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  5,  7,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  4,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  4,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  8}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0, 11,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5, 10,255},
+        {255,255,255}, {  0,  2,  3}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  6,  9, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  2,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  3,  7,255}, {  4,  5,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  7, 11}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  8, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  6,255},
+        {255,255,255}, {255,255,255}, {  2,  3,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  2}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  8, 11,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  4,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  5}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  7,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  5, 11,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  7,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4, 10}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  6,  7,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  3,  9, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  2,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  4,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  9,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  8},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  7, 11}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  7,  8, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2, 10,255}, {255,255,255},
+        {  0,  3,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3, 10, 11}, {255,255,255}, {255,255,255}, {  1,  5,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  4,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  7}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  4, 10}, {  5,  6,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,  7,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  4,  5, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  9,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  8, 11},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  4,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  9,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  6, 10, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  5,  6}, {  4,  8, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  3,  6}, {255,255,255}, {  0,  4, 11}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  8,  9,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  5, 10}, {  0,  6,  8}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2, 11,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  1,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  7,  8, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  5,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  5},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  3,  5,  8}, {255,255,255}, {255,255,255}, {  1, 10, 11}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  7, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  4}, {255,255,255}, {  1,  6, 11}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  8},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  5,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  6, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  7, 11}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5,  9}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  4,  5}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  8, 10}, {  4,  5,  6}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  3,  7}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  3, 10}, {255,255,255}, {255,255,255}, {  5,  8, 11}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  5,  7}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  4,  6,  8}, {  0,  5, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, { 11,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5, 11},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  7,  8}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  1,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, { 10,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,  5,  7}, {255,255,255}, {255,255,255}, {  4,  9,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  8, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  5,  8, 10}, {  0,  4,  6}, {255,255,255}, {  1,  3, 11}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  4,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  2,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,  6, 11}, {255,255,255}, {  0,  1,  4}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  6,255}, {255,255,255}, {255,255,255},
+        {  3,  4,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  6, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  6,  7},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  7,  9,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  4,  5},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  5, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  4,  7,  9}, {255,255,255}, {255,255,255}, {  3,  5,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  7}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  8, 11}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  7, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  6,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3,  8,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  6},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  2,  4}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  9,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  6,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  6,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  5,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4, 10,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  4}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  6,  8,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  3,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  8,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  4, 11,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  9, 10, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  6,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  5,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  7, 11,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,  8, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  5,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  2,  3,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  3,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  6,  9}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2, 11}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  8,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  7,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  8, 10, 11}, {255,255,255}, {255,255,255}, {  1,  3,  5}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  4,  6, 10}, {  0,  5,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  3,  7, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  1,  3,  8}, {255,255,255}, {255,255,255}, {  5, 10, 11}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  6,  9,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  1,  6}, {255,255,255}, {  3,  4, 11}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  7, 10}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  9,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  2,  4,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  6,  8},
+        {255,255,255}, {  2,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0,  4,  7}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4, 10},
+        {  3,  5,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  1,  4, 11}, {255,255,255}, {  0,  3,  6}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  9, 11}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  3,  9,255}, {  4,  5,  7}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1,  6,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  6,  7, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  3,  4, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  5,  6},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  4,  7,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  5,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  0, 10, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  7, 11},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  8,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3,  7, 10}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  1,  3}, {255,255,255}, {  4,  6, 11}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  0,  9, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  2,  3,  6}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  4,  8,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6, 11,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  5,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  4,  5,255}, {  3,  7,  9}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  8,  9, 10},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,  5}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  3, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  7,  8,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2, 10, 11}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  1, 11,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  0,  2,  8}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  3},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {  3,  4,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  7,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1, 10,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  0,  7,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  5,  8},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  6,  7,  9}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  3, 11,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  2,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  4,  9}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {  4,  6,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  1,  2,  6}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  4,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {  8,  9, 11}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  1,  7,  9}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  2,  4,  7}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  0,  9, 10}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {  5,  9, 11}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {  6, 10,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255},
+        {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}, {255,255,255}
+};
+
+// rows of m_G and m_H as codewords packed MSB first for the word based methods
+const uint32_t Golay_24_12::m_Gw[12] = {
+        0x800C75, 0x40063B, 0x200F68, 0x1007B4, 0x0803DA, 0x040D99, 0x0206CD, 0x010367,
+        0x008DC6, 0x004A97, 0x00293E, 0x0018EB
+};
+
+const uint32_t Golay_24_12::m_Hw[12] = {
+        0xA4F800, 0xF68400, 0x7B4200, 0x3DA100, 0x1ED080, 0xAB9040, 0xF13020, 0xDC6010,
+        0x6E3008, 0x93E004, 0x49F002, 0xC75001
+};
+
 // ========================================================================================
 
 const unsigned char QR_16_7_6::m_G[16*7] = {
@@ -276,11 +1608,150 @@ const unsigned char QR_16_7_6::m_H[16*9] = {
         1, 0, 1,  0, 1, 1, 1,   0, 0, 0, 0, 0, 0, 0, 0, 1,
 };
 
+// positions of the bits to flip with the syndrome as index for all error patterns of up to 2 bits.
+// Syndromes are computed with m_H. 255 ends the list.
+const unsigned char QR_16_7_6::m_corr[512][2] = {
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {  3,  4}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {  0,  6}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  0,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  2,  3}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {  6,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  2,  4}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  5,  6}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {  1,  2}, {  0,  5}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  1,  4},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  5,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {  1,  3}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  3,  5},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  1,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {  4,  5}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {  0,  1}, {  2,  5}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  1,  6}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  0,  4}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {  3,  6}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  0,  3}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {  2,255},
+        {255,255}, {255,255}, {  4,  6}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {  2,  6}, {255,255}, {255,255}, {255,255},
+        {255,255}, {  4,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {  3,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255}, {255,255},
+        {  0,  2}, {255,255}, {255,255}, {  1,  5}, {255,255}, {255,255}, {255,255}, {255,255}
+};
+
+// rows of m_G and m_H as codewords packed MSB first for the word based methods
+const uint32_t QR_16_7_6::m_Gw[7] = {
+        0x804F, 0x411E, 0x21B7, 0x11E2, 0x09C9, 0x04E5, 0x0273
+};
+
+const uint32_t QR_16_7_6::m_Hw[9] = {
+        0x7900, 0x3C80, 0x9E40, 0x3620, 0x6210, 0xC808, 0xE404, 0xF202,
+        0xAE01
+};
+
+// ========================================================================================
+
+static inline uint32_t parity(uint32_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_parity(x);
+#else
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return x & 1;
+#endif
+}
+
+// XOR of the generator rows selected by the data bits (MSB is the first data bit)
+static inline uint32_t encodeWithRows(uint32_t data, const uint32_t *Gw, int k)
+{
+    uint32_t codeword = 0;
+
+    for (int i = 0; i < k; i++)
+    {
+        if ((data >> (k - 1 - i)) & 1) {
+            codeword ^= Gw[i];
+        }
+    }
+
+    return codeword;
+}
+
+// Syndrome bits in the same order as the index of the m_corr tables (first parity check row is the MSB).
+// Flips the bits listed in the correction table entry. The list ends with 0xFF and is empty if not correctable.
+static inline int correctWithRows(uint32_t& codeword,
+        int n,
+        const uint32_t *Hw,
+        int nbRows,
+        const unsigned char *corr,
+        int maxErrors)
+{
+    codeword &= (1U << n) - 1;
+    unsigned int syndromeI = 0;
+
+    for (int is = 0; is < nbRows; is++) {
+        syndromeI = (syndromeI << 1) | parity(codeword & Hw[is]);
+    }
+
+    if (syndromeI == 0) {
+        return 0;
+    }
+
+    const unsigned char *flips = &corr[maxErrors*syndromeI];
+    int i = 0;
+
+    for (; (i < maxErrors) && (flips[i] != 0xFF); i++) {
+        codeword ^= 1U << (n - 1 - flips[i]);
+    }
+
+    return i == 0 ? -1 : i;
+}
+
 // ========================================================================================
 
 Hamming_7_4::Hamming_7_4()
 {
-    init();
 }
 
 Hamming_7_4::~Hamming_7_4()
@@ -308,39 +1779,41 @@ void Hamming_7_4::encode(unsigned char *origBits, unsigned char *encodedBits)
 
 bool Hamming_7_4::decode(unsigned char *rxBits) // corrects in place
 {
-    unsigned int syndromeI = 0; // syndrome index
+    uint32_t codeword = FECBits::pack(rxBits, 7);
 
-    for (int is = 0; is < 3; is++)
-    {
-        syndromeI += (((rxBits[0] * m_H[7*is + 0])
-                    + (rxBits[1] * m_H[7*is + 1])
-                    + (rxBits[2] * m_H[7*is + 2])
-                    + (rxBits[3] * m_H[7*is + 3])
-                    + (rxBits[4] * m_H[7*is + 4])
-                    + (rxBits[5] * m_H[7*is + 5])
-                    + (rxBits[6] * m_H[7*is + 6])) % 2) << (2-is);
+    if (correctWord(codeword) < 0) {
+        return false;
     }
 
-    if (syndromeI > 0)
-    {
-        if (m_corr[syndromeI] == 0xFF)
-        {
-            return false;
-        }
-        else
-        {
-            rxBits[m_corr[syndromeI]] ^= 1; // flip bit
-        }
+    FECBits::unpack(codeword, rxBits, 7);
+    return true;
+}
+
+uint32_t Hamming_7_4::encodeWord(uint32_t data)
+{
+    return encodeWithRows(data, m_Gw, 4);
+}
+
+int Hamming_7_4::correctWord(uint32_t& codeword)
+{
+    return correctWithRows(codeword, 7, m_Hw, 3, m_corr, 1);
+}
+
+int Hamming_7_4::decodeWord(uint32_t codeword, uint32_t& data)
+{
+    int nbErrors = correctWithRows(codeword, 7, m_Hw, 3, m_corr, 1);
+
+    if (nbErrors >= 0) {
+        data = codeword >> 3;
     }
 
-    return true;
+    return nbErrors;
 }
 
 // ========================================================================================
 
 Hamming_12_8::Hamming_12_8()
 {
-    init();
 }
 
 Hamming_12_8::~Hamming_12_8()
@@ -372,39 +1845,15 @@ bool Hamming_12_8::decode(unsigned char *rxBits, unsigned char *decodedBits, int
 
     for (int ic = 0; ic < nbCodewords; ic++)
     {
-        // calculate syndrome
-
-        bool error = false;
-        int syndromeI = 0; // syndrome index
+        uint32_t codeword = FECBits::pack(&rxBits[12*ic], 12);
 
-        for (int is = 0; is < 4; is++)
+        if (correctWord(codeword) < 0) // uncorrectable error
         {
-            syndromeI += (((rxBits[12*ic +  0] * m_H[12*is +  0])
-                         + (rxBits[12*ic +  1] * m_H[12*is +  1])
-                         + (rxBits[12*ic +  2] * m_H[12*is +  2])
-                         + (rxBits[12*ic +  3] * m_H[12*is +  3])
-                         + (rxBits[12*ic +  4] * m_H[12*is +  4])
-                         + (rxBits[12*ic +  5] * m_H[12*is +  5])
-                         + (rxBits[12*ic +  6] * m_H[12*is +  6])
-                         + (rxBits[12*ic +  7] * m_H[12*is +  7])
-                         + (rxBits[12*ic +  8] * m_H[12*is +  8])
-                         + (rxBits[12*ic +  9] * m_H[12*is +  9])
-                         + (rxBits[12*ic + 10] * m_H[12*is + 10])
-                         + (rxBits[12*ic + 11] * m_H[12*is + 11])) % 2) << (3-is);
+            correctable = false;
         }
-
-        // correct bit
-
-        if (syndromeI > 0) // single bit error correction
+        else
         {
-            if (m_corr[syndromeI] == 0xFF) // uncorrectable error
-            {
-                correctable = false;
-            }
-            else
-            {
-                rxBits[m_corr[syndromeI]] ^= 1; // flip bit
-            }
+            FECBits::unpack(codeword, &rxBits[12*ic], 12);
         }
 
         // move information bits
@@ -414,11 +1863,31 @@ bool Hamming_12_8::decode(unsigned char *rxBits, unsigned char *decodedBits, int
     return correctable;
 }
 
+uint32_t Hamming_12_8::encodeWord(uint32_t data)
+{
+    return encodeWithRows(data, m_Gw, 8);
+}
+
+int Hamming_12_8::correctWord(uint32_t& codeword)
+{
+    return correctWithRows(codeword, 12, m_Hw, 4, m_corr, 1);
+}
+
+int Hamming_12_8::decodeWord(uint32_t codeword, uint32_t& data)
+{
+    int nbErrors = correctWithRows(codeword, 12, m_Hw, 4, m_corr, 1);
+
+    if (nbErrors >= 0) {
+        data = codeword >> 4;
+    }
+
+    return nbErrors;
+}
+
 // ========================================================================================
 
 Hamming_16_11_4::Hamming_16_11_4()
 {
-    init();
 }
 
 Hamming_16_11_4::~Hamming_16_11_4()
@@ -450,44 +1919,16 @@ bool Hamming_16_11_4::decode(unsigned char *rxBits, unsigned char *decodedBits,
 
     for (int ic = 0; ic < nbCodewords; ic++)
     {
-        // calculate syndrome
-
-        bool error = false;
-        int syndromeI = 0; // syndrome index
+        uint32_t codeword = FECBits::pack(&rxBits[16*ic], 16);
 
-        for (int is = 0; is < 5; is++)
+        if (correctWord(codeword) < 0) // uncorrectable error
         {
-            syndromeI += (((rxBits[16*ic +  0] * m_H[16*is +  0])
-                         + (rxBits[16*ic +  1] * m_H[16*is +  1])
-                         + (rxBits[16*ic +  2] * m_H[16*is +  2])
-                         + (rxBits[16*ic +  3] * m_H[16*is +  3])
-                         + (rxBits[16*ic +  4] * m_H[16*is +  4])
-                         + (rxBits[16*ic +  5] * m_H[16*is +  5])
-                         + (rxBits[16*ic +  6] * m_H[16*is +  6])
-                         + (rxBits[16*ic +  7] * m_H[16*is +  7])
-                         + (rxBits[16*ic +  8] * m_H[16*is +  8])
-                         + (rxBits[16*ic +  9] * m_H[16*is +  9])
-                         + (rxBits[16*ic + 10] * m_H[16*is + 10])
-                         + (rxBits[16*ic + 11] * m_H[16*is + 11])
-                         + (rxBits[16*ic + 12] * m_H[16*is + 12])
-                         + (rxBits[16*ic + 13] * m_H[16*is + 13])
-                         + (rxBits[16*ic + 14] * m_H[16*is + 14])
-                         + (rxBits[16*ic + 15] * m_H[16*is + 15])) % 2) << (4-is);
+            correctable = false;
+            break;
         }
-
-        // correct bit
-
-        if (syndromeI > 0) // single bit error correction
+        else
         {
-            if (m_corr[syndromeI] == 0xFF) // uncorrectable error
-            {
-                correctable = false;
-                break;
-            }
-            else
-            {
-                rxBits[m_corr[syndromeI]] ^= 1; // flip bit
-            }
+            FECBits::unpack(codeword, &rxBits[16*ic], 16);
         }
 
         // move information bits
@@ -500,11 +1941,31 @@ bool Hamming_16_11_4::decode(unsigned char *rxBits, unsigned char *decodedBits,
     return correctable;
 }
 
+uint32_t Hamming_16_11_4::encodeWord(uint32_t data)
+{
+    return encodeWithRows(data, m_Gw, 11);
+}
+
+int Hamming_16_11_4::correctWord(uint32_t& codeword)
+{
+    return correctWithRows(codeword, 16, m_Hw, 5, m_corr, 1);
+}
+
+int Hamming_16_11_4::decodeWord(uint32_t codeword, uint32_t& data)
+{
+    int nbErrors = correctWithRows(codeword, 16, m_Hw, 5, m_corr, 1);
+
+    if (nbErrors >= 0) {
+        data = codeword >> 5;
+    }
+
+    return nbErrors;
+}
+
 // ========================================================================================
 
 Hamming_15_11::Hamming_15_11()
 {
-    init();
 }
 
 Hamming_15_11::~Hamming_15_11()
@@ -536,43 +1997,16 @@ bool Hamming_15_11::decode(unsigned char *rxBits, unsigned char *decodedBits, in
 
     for (int ic = 0; ic < nbCodewords; ic++)
     {
-        // calculate syndrome
+        uint32_t codeword = FECBits::pack(&rxBits[15*ic], 15);
 
-        bool error = false;
-        int syndromeI = 0; // syndrome index
-
-        for (int is = 0; is < 4; is++)
+        if (correctWord(codeword) < 0) // uncorrectable error
         {
-            syndromeI += (((rxBits[15*ic +  0] * m_H[15*is +  0])
-                         + (rxBits[15*ic +  1] * m_H[15*is +  1])
-                         + (rxBits[15*ic +  2] * m_H[15*is +  2])
-                         + (rxBits[15*ic +  3] * m_H[15*is +  3])
-                         + (rxBits[15*ic +  4] * m_H[15*is +  4])
-                         + (rxBits[15*ic +  5] * m_H[15*is +  5])
-                         + (rxBits[15*ic +  6] * m_H[15*is +  6])
-                         + (rxBits[15*ic +  7] * m_H[15*is +  7])
-                         + (rxBits[15*ic +  8] * m_H[15*is +  8])
-                         + (rxBits[15*ic +  9] * m_H[15*is +  9])
-                         + (rxBits[15*ic + 10] * m_H[15*is + 10])
-                         + (rxBits[15*ic + 11] * m_H[15*is + 11])
-                         + (rxBits[15*ic + 12] * m_H[15*is + 12])
-                         + (rxBits[15*ic + 13] * m_H[15*is + 13])
-                         + (rxBits[15*ic + 14] * m_H[15*is + 14])) % 2) << (3-is);
+            correctable = false;
+            break;
         }
-
-        // correct bit
-
-        if (syndromeI > 0) // single bit error correction
+        else
         {
-            if (m_corr[syndromeI] == 0xFF) // uncorrectable error
-            {
-                correctable = false;
-                break;
-            }
-            else
-            {
-                rxBits[m_corr[syndromeI]] ^= 1; // flip bit
-            }
+            FECBits::unpack(codeword, &rxBits[15*ic], 15);
         }
 
         // move information bits
@@ -585,62 +2019,35 @@ bool Hamming_15_11::decode(unsigned char *rxBits, unsigned char *decodedBits, in
     return correctable;
 }
 
-// ========================================================================================
-
-Golay_20_8::Golay_20_8()
+uint32_t Hamming_15_11::encodeWord(uint32_t data)
 {
-    init();
+    return encodeWithRows(data, m_Gw, 11);
 }
 
-Golay_20_8::~Golay_20_8()
+int Hamming_15_11::correctWord(uint32_t& codeword)
 {
+    return correctWithRows(codeword, 15, m_Hw, 4, m_corr, 1);
 }
 
-void Golay_20_8::init()
+int Hamming_15_11::decodeWord(uint32_t codeword, uint32_t& data)
 {
-    memset (m_corr, 0xFF, 3*4096);
+    int nbErrors = correctWithRows(codeword, 15, m_Hw, 4, m_corr, 1);
 
-    for (int i1 = 0; i1 < 8; i1++)
-    {
-        for (int i2 = i1+1; i2 < 8; i2++)
-        {
-            for (int i3 = i2+1; i3 < 8; i3++)
-            {
-                // 3 bit patterns
-                int syndromeI = 0;
-
-                for (int ir = 0; ir < 12; ir++)
-                {
-                    syndromeI += ((m_H[20*ir + i1] +  m_H[20*ir + i2] +  m_H[20*ir + i3]) % 2) << (11-ir);
-                }
-
-                m_corr[syndromeI][0] = i1;
-                m_corr[syndromeI][1] = i2;
-                m_corr[syndromeI][2] = i3;
-            }
-
-            // 2 bit patterns
-            int syndromeI = 0;
-
-            for (int ir = 0; ir < 12; ir++)
-            {
-                syndromeI += ((m_H[20*ir + i1] +  m_H[20*ir + i2]) % 2) << (11-ir);
-            }
-
-            m_corr[syndromeI][0] = i1;
-            m_corr[syndromeI][1] = i2;
-        }
+    if (nbErrors >= 0) {
+        data = codeword >> 4;
+    }
 
-        // single bit patterns
-        int syndromeI = 0;
+    return nbErrors;
+}
 
-        for (int ir = 0; ir < 12; ir++)
-        {
-            syndromeI += m_H[20*ir + i1] << (11-ir);
-        }
+// ========================================================================================
 
-        m_corr[syndromeI][0] = i1;
-    }
+Golay_20_8::Golay_20_8()
+{
+}
+
+Golay_20_8::~Golay_20_8()
+{
 }
 
 // Not very efficient but encode is used for unit testing only
@@ -662,115 +2069,47 @@ void Golay_20_8::encode(unsigned char *origBits, unsigned char *encodedBits)
     }
 }
 
-bool Golay_20_8::decode(unsigned char *rxBits)
+bool Golay_20_8::decode(unsigned char *rxBits) // corrects in place
 {
-    unsigned int syndromeI = 0; // syndrome index
+    uint32_t codeword = FECBits::pack(rxBits, 20);
 
-    for (int is = 0; is < 12; is++)
-    {
-        syndromeI += (((rxBits[0] * m_H[20*is + 0])
-                    + (rxBits[1] * m_H[20*is + 1])
-                    + (rxBits[2] * m_H[20*is + 2])
-                    + (rxBits[3] * m_H[20*is + 3])
-                    + (rxBits[4] * m_H[20*is + 4])
-                    + (rxBits[5] * m_H[20*is + 5])
-                    + (rxBits[6] * m_H[20*is + 6])
-                    + (rxBits[7] * m_H[20*is + 7])
-                    + (rxBits[8] * m_H[20*is + 8])
-                    + (rxBits[9] * m_H[20*is + 9])
-                    + (rxBits[10] * m_H[20*is + 10])
-                    + (rxBits[11] * m_H[20*is + 11])
-                    + (rxBits[12] * m_H[20*is + 12])
-                    + (rxBits[13] * m_H[20*is + 13])
-                    + (rxBits[14] * m_H[20*is + 14])
-                    + (rxBits[15] * m_H[20*is + 15])
-                    + (rxBits[16] * m_H[20*is + 16])
-                    + (rxBits[17] * m_H[20*is + 17])
-                    + (rxBits[18] * m_H[20*is + 18])
-                    + (rxBits[19] * m_H[20*is + 19])) % 2) << (11-is);
-    }
-
-    if (syndromeI > 0)
-    {
-        int i = 0;
-
-        for (; i < 3; i++)
-        {
-            if (m_corr[syndromeI][i] == 0xFF)
-            {
-                break;
-            }
-            else
-            {
-                rxBits[m_corr[syndromeI][i]] ^= 1; // flip bit
-            }
-        }
-
-        if (i == 0)
-        {
-            return false;
-        }
+    if (correctWord(codeword) < 0) {
+        return false;
     }
 
+    FECBits::unpack(codeword, rxBits, 20);
     return true;
 }
 
-// ========================================================================================
-
-Golay_23_12::Golay_23_12()
+uint32_t Golay_20_8::encodeWord(uint32_t data)
 {
-    init();
+    return encodeWithRows(data, m_Gw, 8);
 }
 
-Golay_23_12::~Golay_23_12()
+int Golay_20_8::correctWord(uint32_t& codeword)
 {
+    return correctWithRows(codeword, 20, m_Hw, 12, &m_corr[0][0], 3);
 }
 
-void Golay_23_12::init()
+int Golay_20_8::decodeWord(uint32_t codeword, uint32_t& data)
 {
-    memset (m_corr, 0xFF, 3*2048);
+    int nbErrors = correctWithRows(codeword, 20, m_Hw, 12, &m_corr[0][0], 3);
 
-    for (int i1 = 0; i1 < 11; i1++)
-    {
-        for (int i2 = i1+1; i2 < 11; i2++)
-        {
-            for (int i3 = i2+1; i3 < 11; i3++)
-            {
-                // 3 bit patterns
-                int syndromeI = 0;
-
-                for (int ir = 0; ir < 11; ir++)
-                {
-                    syndromeI += ((m_H[23*ir + i1] +  m_H[23*ir + i2] +  m_H[23*ir + i3]) % 2) << (10-ir);
-                }
-
-                m_corr[syndromeI][0] = i1;
-                m_corr[syndromeI][1] = i2;
-                m_corr[syndromeI][2] = i3;
-            }
-
-            // 2 bit patterns
-            int syndromeI = 0;
-
-            for (int ir = 0; ir < 11; ir++)
-            {
-                syndromeI += ((m_H[23*ir + i1] +  m_H[23*ir + i2]) % 2) << (10-ir);
-            }
-
-            m_corr[syndromeI][0] = i1;
-            m_corr[syndromeI][1] = i2;
-        }
+    if (nbErrors >= 0) {
+        data = codeword >> 12;
+    }
 
-        // single bit patterns
-        int syndromeI = 0;
+    return nbErrors;
+}
 
-        for (int ir = 0; ir < 11; ir++)
-        {
-            syndromeI += m_H[23*ir + i1] << (10-ir);
-        }
+// ========================================================================================
 
-        m_corr[syndromeI][0] = i1;
-    }
+Golay_23_12::Golay_23_12()
+{
+}
+
+Golay_23_12::~Golay_23_12()
+{
 }
 
 // Not very efficient but encode is used for unit testing only
@@ -792,118 +2131,47 @@ void Golay_23_12::encode(unsigned char *origBits, unsigned char *encodedBits)
     }
 }
 
-bool Golay_23_12::decode(unsigned char *rxBits)
+bool Golay_23_12::decode(unsigned char *rxBits) // corrects in place
 {
-    unsigned int syndromeI = 0; // syndrome index
+    uint32_t codeword = FECBits::pack(rxBits, 23);
 
-    for (int is = 0; is < 11; is++)
-    {
-        syndromeI += (((rxBits[0] * m_H[23*is + 0])
-                    + (rxBits[1] * m_H[23*is + 1])
-                    + (rxBits[2] * m_H[23*is + 2])
-                    + (rxBits[3] * m_H[23*is + 3])
-                    + (rxBits[4] * m_H[23*is + 4])
-                    + (rxBits[5] * m_H[23*is + 5])
-                    + (rxBits[6] * m_H[23*is + 6])
-                    + (rxBits[7] * m_H[23*is + 7])
-                    + (rxBits[8] * m_H[23*is + 8])
-                    + (rxBits[9] * m_H[23*is + 9])
-                    + (rxBits[10] * m_H[23*is + 10])
-                    + (rxBits[11] * m_H[23*is + 11])
-                    + (rxBits[12] * m_H[23*is + 12])
-                    + (rxBits[13] * m_H[23*is + 13])
-                    + (rxBits[14] * m_H[23*is + 14])
-                    + (rxBits[15] * m_H[23*is + 15])
-                    + (rxBits[16] * m_H[23*is + 16])
-                    + (rxBits[17] * m_H[23*is + 17])
-                    + (rxBits[18] * m_H[23*is + 18])
-                    + (rxBits[19] * m_H[23*is + 19])
-                    + (rxBits[20] * m_H[23*is + 20])
-                    + (rxBits[21] * m_H[23*is + 21])
-                    + (rxBits[22] * m_H[23*is + 22])) % 2) << (10-is);
-    }
-
-    if (syndromeI > 0)
-    {
-        int i = 0;
-
-        for (; i < 3; i++)
-        {
-            if (m_corr[syndromeI][i] == 0xFF)
-            {
-                break;
-            }
-            else
-            {
-                rxBits[m_corr[syndromeI][i]] ^= 1; // flip bit
-            }
-        }
-
-        if (i == 0)
-        {
-            return false;
-        }
+    if (correctWord(codeword) < 0) {
+        return false;
     }
 
+    FECBits::unpack(codeword, rxBits, 23);
     return true;
 }
 
-// ========================================================================================
-
-Golay_24_12::Golay_24_12()
+uint32_t Golay_23_12::encodeWord(uint32_t data)
 {
-    init();
+    return encodeWithRows(data, m_Gw, 12);
 }
 
-Golay_24_12::~Golay_24_12()
+int Golay_23_12::correctWord(uint32_t& codeword)
 {
+    return correctWithRows(codeword, 23, m_Hw, 11, &m_corr[0][0], 3);
 }
 
-void Golay_24_12::init()
+int Golay_23_12::decodeWord(uint32_t codeword, uint32_t& data)
 {
-    memset (m_corr, 0xFF, 3*4096);
+    int nbErrors = correctWithRows(codeword, 23, m_Hw, 11, &m_corr[0][0], 3);
 
-    for (int i1 = 0; i1 < 12; i1++)
-    {
-        for (int i2 = i1+1; i2 < 12; i2++)
-        {
-            for (int i3 = i2+1; i3 < 12; i3++)
-            {
-                // 3 bit patterns
-                int syndromeI = 0;
-
-                for (int ir = 0; ir < 12; ir++)
-                {
-                    syndromeI += ((m_H[24*ir + i1] +  m_H[24*ir + i2] +  m_H[24*ir + i3]) % 2) << (11-ir);
-                }
-
-                m_corr[syndromeI][0] = i1;
-                m_corr[syndromeI][1] = i2;
-                m_corr[syndromeI][2] = i3;
-            }
-
-            // 2 bit patterns
-            int syndromeI = 0;
-
-            for (int ir = 0; ir < 12; ir++)
-            {
-                syndromeI += ((m_H[24*ir + i1] +  m_H[24*ir + i2]) % 2) << (11-ir);
-            }
-
-            m_corr[syndromeI][0] = i1;
-            m_corr[syndromeI][1] = i2;
-        }
+    if (nbErrors >= 0) {
+        data = codeword >> 11;
+    }
+
+    return nbErrors;
+}
 
-        // single bit patterns
-        int syndromeI = 0;
+// ========================================================================================
 
-        for (int ir = 0; ir < 12; ir++)
-        {
-            syndromeI += m_H[24*ir + i1] << (11-ir);
-        }
+Golay_24_12::Golay_24_12()
+{
+}
 
-        m_corr[syndromeI][0] = i1;
-    }
+Golay_24_12::~Golay_24_12()
+{
 }
 
 // Not very efficient but encode is used for unit testing only
@@ -925,104 +2193,47 @@ void Golay_24_12::encode(unsigned char *origBits, unsigned char *encodedBits)
     }
 }
 
-bool Golay_24_12::decode(unsigned char *rxBits)
+bool Golay_24_12::decode(unsigned char *rxBits) // corrects in place
 {
-    unsigned int syndromeI = 0; // syndrome index
-
-    for (int is = 0; is < 12; is++)
-    {
-        syndromeI += (((rxBits[0] * m_H[24*is + 0])
-                    + (rxBits[1] * m_H[24*is + 1])
-                    + (rxBits[2] * m_H[24*is + 2])
-                    + (rxBits[3] * m_H[24*is + 3])
-                    + (rxBits[4] * m_H[24*is + 4])
-                    + (rxBits[5] * m_H[24*is + 5])
-                    + (rxBits[6] * m_H[24*is + 6])
-                    + (rxBits[7] * m_H[24*is + 7])
-                    + (rxBits[8] * m_H[24*is + 8])
-                    + (rxBits[9] * m_H[24*is + 9])
-                    + (rxBits[10] * m_H[24*is + 10])
-                    + (rxBits[11] * m_H[24*is + 11])
-                    + (rxBits[12] * m_H[24*is + 12])
-                    + (rxBits[13] * m_H[24*is + 13])
-                    + (rxBits[14] * m_H[24*is + 14])
-                    + (rxBits[15] * m_H[24*is + 15])
-                    + (rxBits[16] * m_H[24*is + 16])
-                    + (rxBits[17] * m_H[24*is + 17])
-                    + (rxBits[18] * m_H[24*is + 18])
-                    + (rxBits[19] * m_H[24*is + 19])
-                    + (rxBits[20] * m_H[24*is + 20])
-                    + (rxBits[21] * m_H[24*is + 21])
-                    + (rxBits[22] * m_H[24*is + 22])
-                    + (rxBits[23] * m_H[24*is + 23])) % 2) << (11-is);
-    }
-
-    if (syndromeI > 0)
-    {
-        int i = 0;
-
-        for (; i < 3; i++)
-        {
-            if (m_corr[syndromeI][i] == 0xFF)
-            {
-                break;
-            }
-            else
-            {
-                rxBits[m_corr[syndromeI][i]] ^= 1; // flip bit
-            }
-        }
+    uint32_t codeword = FECBits::pack(rxBits, 24);
 
-        if (i == 0)
-        {
-            return false;
-        }
+    if (correctWord(codeword) < 0) {
+        return false;
     }
 
+    FECBits::unpack(codeword, rxBits, 24);
     return true;
 }
 
-// ========================================================================================
-
-QR_16_7_6::QR_16_7_6()
+uint32_t Golay_24_12::encodeWord(uint32_t data)
 {
-    init();
+    return encodeWithRows(data, m_Gw, 12);
 }
 
-QR_16_7_6::~QR_16_7_6()
+int Golay_24_12::correctWord(uint32_t& codeword)
 {
+    return correctWithRows(codeword, 24, m_Hw, 12, &m_corr[0][0], 3);
 }
 
-void QR_16_7_6::init()
+int Golay_24_12::decodeWord(uint32_t codeword, uint32_t& data)
 {
-    memset (m_corr, 0xFF, 2*512);
+    int nbErrors = correctWithRows(codeword, 24, m_Hw, 12, &m_corr[0][0], 3);
 
-    for (int i1 = 0; i1 < 7; i1++)
-    {
-        for (int i2 = i1+1; i2 < 7; i2++)
-        {
-            // 2 bit patterns
-            int syndromeI = 0;
-
-            for (int ir = 0; ir < 9; ir++)
-            {
-                syndromeI += ((m_H[16*ir + i1] +  m_H[16*ir + i2]) % 2) << (8-ir);
-            }
+    if (nbErrors >= 0) {
+        data = codeword >> 12;
+    }
 
-            m_corr[syndromeI][0] = i1;
-            m_corr[syndromeI][1] = i2;
-        }
+    return nbErrors;
+}
 
-        // single bit patterns
-        int syndromeI = 0;
+// ========================================================================================
 
-        for (int ir = 0; ir < 9; ir++)
-        {
-            syndromeI += m_H[16*ir + i1] << (8-ir);
-        }
+QR_16_7_6::QR_16_7_6()
+{
+}
 
-        m_corr[syndromeI][0] = i1;
-    }
+QR_16_7_6::~QR_16_7_6()
+{
 }
 
 // Not very efficient but encode is used for unit testing only
@@ -1044,53 +2255,37 @@ void QR_16_7_6::encode(unsigned char *origBits, unsigned char *encodedBits)
     }
 }
 
-bool QR_16_7_6::decode(unsigned char *rxBits)
+bool QR_16_7_6::decode(unsigned char *rxBits) // corrects in place
 {
-    unsigned int syndromeI = 0; // syndrome index
+    uint32_t codeword = FECBits::pack(rxBits, 16);
 
-    for (int is = 0; is < 9; is++)
-    {
-        syndromeI += (((rxBits[0] * m_H[16*is + 0])
-                    + (rxBits[1] * m_H[16*is + 1])
-                    + (rxBits[2] * m_H[16*is + 2])
-                    + (rxBits[3] * m_H[16*is + 3])
-                    + (rxBits[4] * m_H[16*is + 4])
-                    + (rxBits[5] * m_H[16*is + 5])
-                    + (rxBits[6] * m_H[16*is + 6])
-                    + (rxBits[7] * m_H[16*is + 7])
-                    + (rxBits[8] * m_H[16*is + 8])
-                    + (rxBits[9] * m_H[16*is + 9])
-                    + (rxBits[10] * m_H[16*is + 10])
-                    + (rxBits[11] * m_H[16*is + 11])
-                    + (rxBits[12] * m_H[16*is + 12])
-                    + (rxBits[13] * m_H[16*is + 13])
-                    + (rxBits[14] * m_H[16*is + 14])
-                    + (rxBits[15] * m_H[16*is + 15])) % 2) << (8-is);
+    if (correctWord(codeword) < 0) {
+        return false;
     }
 
-    if (syndromeI > 0)
-    {
-        int i = 0;
+    FECBits::unpack(codeword, rxBits, 16);
+    return true;
+}
 
-        for (; i < 2; i++)
-        {
-            if (m_corr[syndromeI][i] == 0xFF)
-            {
-                break;
-            }
-            else
-            {
-                rxBits[m_corr[syndromeI][i]] ^= 1; // flip bit
-            }
-        }
+uint32_t QR_16_7_6::encodeWord(uint32_t data)
+{
+    return encodeWithRows(data, m_Gw, 7);
+}
 
-        if (i == 0)
-        {
-            return false;
-        }
+int QR_16_7_6::correctWord(uint32_t& codeword)
+{
+    return correctWithRows(codeword, 16, m_Hw, 9, &m_corr[0][0], 2);
+}
+
+int QR_16_7_6::decodeWord(uint32_t codeword, uint32_t& data)
+{
+    int nbErrors = correctWithRows(codeword, 16, m_Hw, 9, &m_corr[0][0], 2);
+
+    if (nbErrors >= 0) {
+        data = codeword >> 9;
     }
 
-    return true;
+    return nbErrors;
 }
 
 } // namespace DSDcc
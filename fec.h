@@ -17,23 +17,57 @@
 #ifndef FEC_H_
 #define FEC_H_
 
+#include <stdint.h>
+
 namespace DSDcc
 {
 
+/**
+ * Conversion between arrays of one bit per byte and codewords packed in a machine word.
+ * The first bit of the array is the MSB of the word.
+ */
+class FECBits
+{
+public:
+    static uint32_t pack(const unsigned char *bits, int nbBits)
+    {
+        uint32_t word = 0;
+
+        for (int i = 0; i < nbBits; i++) {
+            word = (word << 1) | (bits[i] & 1);
+        }
+
+        return word;
+    }
+
+    static void unpack(uint32_t word, unsigned char *bits, int nbBits)
+    {
+        for (int i = 0; i < nbBits; i++) {
+            bits[i] = (word >> (nbBits - 1 - i)) & 1;
+        }
+    }
+};
+
 class Hamming_7_4
 {
 public:
 	Hamming_7_4();
 	~Hamming_7_4();
 
-	void init();
 	void encode(unsigned char *origBits, unsigned char *encodedBits);
 	bool decode(unsigned char *rxBits);
 
+    // Word based variants. Codewords are packed MSB first (first transmitted bit is the MSB) and data is the 4 first bits
+    static uint32_t encodeWord(uint32_t data);
+    static int correctWord(uint32_t& codeword);               //!< corrects in place. Returns the number of bits corrected or -1 if not correctable
+    static int decodeWord(uint32_t codeword, uint32_t& data); //!< same as correctWord and returns the data bits of the corrected codeword
+
 private:
-	unsigned char m_corr[8];             //!< single bit error correction by syndrome index
+	static const unsigned char m_corr[8]; //!< single bit error correction by syndrome index
     static const unsigned char m_G[7*4]; //!< Generator matrix of bits
 	static const unsigned char m_H[7*3]; //!< Parity check matrix of bits
+    static const uint32_t m_Gw[4];  //!< Generator matrix rows as packed codewords
+    static const uint32_t m_Hw[3];  //!< Parity check matrix rows as packed codewords
 };
 
 class Hamming_12_8
@@ -42,14 +76,20 @@ public:
     Hamming_12_8();
     ~Hamming_12_8();
 
-    void init();
 	void encode(unsigned char *origBits, unsigned char *encodedBits);
     bool decode(unsigned char *rxBits, unsigned char *decodedBits, int nbCodewords);
 
+    // Word based variants. Codewords are packed MSB first (first transmitted bit is the MSB) and data is the 8 first bits
+    static uint32_t encodeWord(uint32_t data);
+    static int correctWord(uint32_t& codeword);               //!< corrects in place. Returns the number of bits corrected or -1 if not correctable
+    static int decodeWord(uint32_t codeword, uint32_t& data); //!< same as correctWord and returns the data bits of the corrected codeword
+
 private:
-    unsigned char m_corr[16];             //!< single bit error correction by syndrome index
+    static const unsigned char m_corr[16]; //!< single bit error correction by syndrome index
     static const unsigned char m_G[12*8]; //!< Generator matrix of bits
     static const unsigned char m_H[12*4]; //!< Parity check matrix of bits
+    static const uint32_t m_Gw[8];  //!< Generator matrix rows as packed codewords
+    static const uint32_t m_Hw[4];  //!< Parity check matrix rows as packed codewords
 };
 
 class Hamming_15_11
@@ -58,14 +98,20 @@ public:
     Hamming_15_11();
     ~Hamming_15_11();
 
-    void init();
     void encode(unsigned char *origBits, unsigned char *encodedBits);
     bool decode(unsigned char *rxBits, unsigned char *decodedBits, int nbCodewords);
 
+    // Word based variants. Codewords are packed MSB first (first transmitted bit is the MSB) and data is the 11 first bits
+    static uint32_t encodeWord(uint32_t data);
+    static int correctWord(uint32_t& codeword);               //!< corrects in place. Returns the number of bits corrected or -1 if not correctable
+    static int decodeWord(uint32_t codeword, uint32_t& data); //!< same as correctWord and returns the data bits of the corrected codeword
+
 private:
-    unsigned char m_corr[16];              //!< single bit error correction by syndrome index
+    static const unsigned char m_corr[16]; //!< single bit error correction by syndrome index
     static const unsigned char m_G[15*11]; //!< Generator matrix of bits
     static const unsigned char m_H[15*4];  //!< Parity check matrix of bits
+    static const uint32_t m_Gw[11];  //!< Generator matrix rows as packed codewords
+    static const uint32_t m_Hw[4];  //!< Parity check matrix rows as packed codewords
 };
 
 class Hamming_16_11_4
@@ -74,14 +120,20 @@ public:
     Hamming_16_11_4();
     ~Hamming_16_11_4();
 
-    void init();
     void encode(unsigned char *origBits, unsigned char *encodedBits);
     bool decode(unsigned char *rxBits, unsigned char *decodedBits, int nbCodewords);
 
+    // Word based variants. Codewords are packed MSB first (first transmitted bit is the MSB) and data is the 11 first bits
+    static uint32_t encodeWord(uint32_t data);
+    static int correctWord(uint32_t& codeword);               //!< corrects in place. Returns the number of bits corrected or -1 if not correctable
+    static int decodeWord(uint32_t codeword, uint32_t& data); //!< same as correctWord and returns the data bits of the corrected codeword
+
 private:
-    unsigned char m_corr[32];              //!< single bit error correction by syndrome index
+    static const unsigned char m_corr[32]; //!< single bit error correction by syndrome index
     static const unsigned char m_G[16*11]; //!< Generator matrix of bits
     static const unsigned char m_H[16*5];  //!< Parity check matrix of bits
+    static const uint32_t m_Gw[11];  //!< Generator matrix rows as packed codewords
+    static const uint32_t m_Hw[5];  //!< Parity check matrix rows as packed codewords
 };
 
 class Golay_20_8
@@ -90,14 +142,20 @@ public:
 	Golay_20_8();
 	~Golay_20_8();
 
-	void init();
 	void encode(unsigned char *origBits, unsigned char *encodedBits);
 	bool decode(unsigned char *rxBits);
 
+    // Word based variants. Codewords are packed MSB first (first transmitted bit is the MSB) and data is the 8 first bits
+    static uint32_t encodeWord(uint32_t data);
+    static int correctWord(uint32_t& codeword);               //!< corrects in place. Returns the number of bits corrected or -1 if not correctable
+    static int decodeWord(uint32_t codeword, uint32_t& data); //!< same as correctWord and returns the data bits of the corrected codeword
+
 private:
-	unsigned char m_corr[4096][3];         //!< up to 3 bit error correction by syndrome index
+    static const unsigned char m_corr[4096][3]; //!< up to 3 bit error correction by syndrome index
     static const unsigned char m_G[20*8];  //!< Generator matrix of bits
     static const unsigned char m_H[20*12]; //!< Parity check matrix of bits
+    static const uint32_t m_Gw[8];  //!< Generator matrix rows as packed codewords
+    static const uint32_t m_Hw[12];  //!< Parity check matrix rows as packed codewords
 };
 
 class Golay_23_12
@@ -106,14 +164,20 @@ public:
     Golay_23_12();
     ~Golay_23_12();
 
-    void init();
     void encode(unsigned char *origBits, unsigned char *encodedBits);
     bool decode(unsigned char *rxBits);
 
+    // Word based variants. Codewords are packed MSB first (first transmitted bit is the MSB) and data is the 12 first bits
+    static uint32_t encodeWord(uint32_t data);
+    static int correctWord(uint32_t& codeword);               //!< corrects in place. Returns the number of bits corrected or -1 if not correctable
+    static int decodeWord(uint32_t codeword, uint32_t& data); //!< same as correctWord and returns the data bits of the corrected codeword
+
 private:
-    unsigned char m_corr[2048][3];         //!< up to 3 bit error correction by syndrome index
+    static const unsigned char m_corr[2048][3]; //!< up to 3 bit error correction by syndrome index
     static const unsigned char m_G[23*12]; //!< Generator matrix of bits
     static const unsigned char m_H[23*11]; //!< Parity check matrix of bits
+    static const uint32_t m_Gw[12];  //!< Generator matrix rows as packed codewords
+    static const uint32_t m_Hw[11];  //!< Parity check matrix rows as packed codewords
 };
 
 class Golay_24_12
@@ -122,14 +186,20 @@ public:
     Golay_24_12();
     ~Golay_24_12();
 
-    void init();
     void encode(unsigned char *origBits, unsigned char *encodedBits);
     bool decode(unsigned char *rxBits);
 
+    // Word based variants. Codewords are packed MSB first (first transmitted bit is the MSB) and data is the 12 first bits
+    static uint32_t encodeWord(uint32_t data);
+    static int correctWord(uint32_t& codeword);               //!< corrects in place. Returns the number of bits corrected or -1 if not correctable
+    static int decodeWord(uint32_t codeword, uint32_t& data); //!< same as correctWord and returns the data bits of the corrected codeword
+
 private:
-    unsigned char m_corr[4096][3];         //!< up to 3 bit error correction by syndrome index
+    static const unsigned char m_corr[4096][3]; //!< up to 3 bit error correction by syndrome index
     static const unsigned char m_G[24*12]; //!< Generator matrix of bits
     static const unsigned char m_H[24*12]; //!< Parity check matrix of bits
+    static const uint32_t m_Gw[12];  //!< Generator matrix rows as packed codewords
+    static const uint32_t m_Hw[12];  //!< Parity check matrix rows as packed codewords
 };
 
 class QR_16_7_6
@@ -138,14 +208,20 @@ public:
 	QR_16_7_6();
 	~QR_16_7_6();
 
-	void init();
 	void encode(unsigned char *origBits, unsigned char *encodedBits);
 	bool decode(unsigned char *rxBits);
 
+    // Word based variants. Codewords are packed MSB first (first transmitted bit is the MSB) and data is the 7 first bits
+    static uint32_t encodeWord(uint32_t data);
+    static int correctWord(uint32_t& codeword);               //!< corrects in place. Returns the number of bits corrected or -1 if not correctable
+    static int decodeWord(uint32_t codeword, uint32_t& data); //!< same as correctWord and returns the data bits of the corrected codeword
+
 private:
-	unsigned char m_corr[512][2];          //!< up to 2 bit error correction by syndrome index
+    static const unsigned char m_corr[512][2]; //!< up to 2 bit error correction by syndrome index
     static const unsigned char m_G[16*7];  //!< Generator matrix of bits
 	static const unsigned char m_H[16*9];  //!< Parity check matrix of bits
+    static const uint32_t m_Gw[7];  //!< Generator matrix rows as packed codewords
+    static const uint32_t m_Hw[9];  //!< Parity check matrix rows as packed codewords
 };
 
 } // namespace DSDcc
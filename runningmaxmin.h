@@ -20,97 +20,89 @@
 #ifndef RUNNINGMAXMIN_H_
 #define RUNNINGMAXMIN_H_
 
-#include <stdlib.h>
 #include <stdint.h>
 
 namespace DSDcc
 {
 
-// nextPowerOfTwo returns a power of two that is larger or equal than x.
-inline uint32_t nextPowerOfTwo(uint32_t x)
-{
-    uint32_t result = 1;
-    while (result < x)
-    {
-        result <<= 1;
-    }
-    return result;
-}
-
+#if defined(__GNUC__)
+#define DSDCC_CACHE_ALIGNED __attribute__((aligned(64)))
+#else
+#define DSDCC_CACHE_ALIGNED
+#endif
 
 // actual streaming implementation
+// The node queues are fixed size ring buffers of capacity nodes (a power of two) so that the window
+// width can be changed at any time up to capacity - 2 without any allocation.
 
-template<typename valuetype>
+template<typename valuetype, uint32_t capacity = 512>
 class lemiremaxmintruestreaming
 {
 public:
     explicit lemiremaxmintruestreaming(uint32_t width) :
-            up(), lo(), n(0), ww(width)
+            n(0)
     {
-        init(&up, ww);
-        init(&lo, ww);
+        resize(width);
     }
 
-    ~lemiremaxmintruestreaming()
+    // changes the window width and restarts the window
+    void resize(uint32_t width)
     {
-        freenodes(&up);
-        freenodes(&lo);
+        ww = width < capacity - 1 ? width : capacity - 2; // a full window holds width + 1 nodes
+        up.head = 0;
+        up.tail = 0;
+        lo.head = 0;
+        lo.tail = 0;
     }
 
-    void resize(uint32_t width)
+    uint32_t width() const
     {
-        ww = width;
-        freenodes(&up);
-        freenodes(&lo);
-        init(&up, ww);
-        init(&lo, ww);
+        return ww;
     }
 
     void update(valuetype value)
     {
-        if (nonempty(&up) != 0)
+        if (up.tail != up.head)
         {
-            if (value > tailvalue(&up))
+            if (value > tailvalue(up))
             {
-                prunetail(&up);
-                while (((nonempty(&up)) != 0) && (value >= tailvalue(&up)))
+                prunetail(up);
+                while ((up.tail != up.head) && (value >= tailvalue(up)))
                 {
-                    prunetail(&up);
+                    prunetail(up);
                 }
             }
             else
             {
-                prunetail(&lo);
-                while (((nonempty(&lo)) != 0) && (value <= tailvalue(&lo)))
+                prunetail(lo);
+                while ((lo.tail != lo.head) && (value <= tailvalue(lo)))
                 {
-                    prunetail(&lo);
+                    prunetail(lo);
                 }
             }
         }
-        push(&up, n, value);
-        if (n == ww + headindex(&up))
-        {
-            prunehead(&up);
-        }
 
-        push(&lo, n, value);
-        if (n == ww + headindex(&lo))
-        {
-            prunehead(&lo);
-        }
+        push(up, n, value);
+        up.head = (up.head + (n - up.nodes[up.head].index == ww)) & mask; // prune head when it leaves the window
+
+        push(lo, n, value);
+        lo.head = (lo.head + (n - lo.nodes[lo.head].index == ww)) & mask;
         n++;
     }
 
-    valuetype max()
+    valuetype max() const
     {
-        return headvalue(&up);
+        return up.nodes[up.head].value;
     }
-    valuetype min()
+    valuetype min() const
     {
-        return headvalue(&lo);
+        return lo.nodes[lo.head].value;
     }
 
 private:
+    typedef char checkcapacity[(capacity >= 2) && ((capacity & (capacity - 1)) == 0) ? 1 : -1];
+    static const uint32_t mask = capacity - 1;
+
     struct valuenode
     {
         uint32_t index;
@@ -119,67 +111,28 @@ private:
 
     struct valuesqueue
     {
-        valuenode * nodes;
+        valuenode nodes[capacity] DSDCC_CACHE_ALIGNED;
         uint32_t head;
         uint32_t tail;
-        uint32_t mask;
     };
 
     // Dequeue methods
 
-    inline uint32_t count(valuesqueue * q)
-    {
-        return (q->tail - q->head) & q->mask;
-    }
-
-    inline void init(valuesqueue * q, uint32_t size)
-    {
-        size = nextPowerOfTwo(size + 1);
-        q->nodes = reinterpret_cast<valuenode *>(malloc(sizeof(valuenode) * size));
-        q->head = 0;
-        q->tail = 0;
-        q->mask = size - 1;
-    }
-
-    inline void freenodes(valuesqueue * q)
-    {
-        free(q->nodes);
-    }
-
-    inline uint32_t headindex(valuesqueue * q)
-    {
-        return q->nodes[q->head].index;
-    }
-
-    inline void push(valuesqueue * q, uint32_t index, valuetype value)
-    {
-        q->nodes[q->tail].index = index;
-        q->nodes[q->tail].value = value;
-        q->tail = (q->tail + 1) & q->mask;
-    }
-
-    inline valuetype tailvalue(valuesqueue * q)
-    {
-        return q->nodes[(q->tail - 1) & q->mask].value;
-    }
-
-    inline valuetype headvalue(valuesqueue * q)
-    {
-        return q->nodes[q->head].value;
-    }
-    inline void prunehead(valuesqueue * q)
+    static inline void push(valuesqueue& q, uint32_t index, valuetype value)
     {
-        q->head = (q->head + 1) & q->mask;
+        q.nodes[q.tail].index = index;
+        q.nodes[q.tail].value = value;
+        q.tail = (q.tail + 1) & mask;
     }
 
-    inline void prunetail(valuesqueue * q)
+    static inline valuetype tailvalue(const valuesqueue& q)
     {
-        q->tail = (q->tail - 1) & q->mask;
+        return q.nodes[(q.tail - 1) & mask].value;
     }
 
-    inline int nonempty(valuesqueue * q)
+    static inline void prunetail(valuesqueue& q)
     {
-        return static_cast<int>(q->tail != q->head);
+        q.tail = (q.tail - 1) & mask;
     }
 
     valuesqueue up;
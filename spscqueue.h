@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPSCQUEUE_H_
+#define SPSCQUEUE_H_
+
+#include <assert.h>
+
+namespace DSDcc
+{
+
+/**
+ * Bounded lock free queue for one producer thread and one consumer thread.
+ * Capacity is rounded up to a power of two. Indexes run freely and are only masked to address items.
+ */
+template<typename T>
+class SPSCQueue
+{
+public:
+    SPSCQueue(unsigned int capacity) :
+        m_head(0),
+        m_tail(0)
+    {
+        assert(capacity > 0);
+        m_capacity = 1;
+
+        while (m_capacity < capacity) {
+            m_capacity <<= 1;
+        }
+
+        m_mask = m_capacity - 1;
+        m_items = new T[m_capacity];
+    }
+
+    ~SPSCQueue()
+    {
+        delete[] m_items;
+    }
+
+    /** Producer side. Returns false if the queue is full */
+    bool push(const T& item)
+    {
+        unsigned int head = m_head;
+
+        if (head - __atomic_load_n(&m_tail, __ATOMIC_ACQUIRE) == m_capacity) {
+            return false;
+        }
+
+        m_items[head & m_mask] = item;
+        __atomic_store_n(&m_head, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /** Consumer side. Returns false if the queue is empty */
+    bool pop(T& item)
+    {
+        unsigned int tail = m_tail;
+
+        if (__atomic_load_n(&m_head, __ATOMIC_ACQUIRE) == tail) {
+            return false;
+        }
+
+        item = m_items[tail & m_mask];
+        __atomic_store_n(&m_tail, tail + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /** Consumer side. Pops up to maxItems items at once and returns the number of items popped */
+    unsigned int pop(T *items, unsigned int maxItems)
+    {
+        unsigned int tail = m_tail;
+        unsigned int nbItems = __atomic_load_n(&m_head, __ATOMIC_ACQUIRE) - tail;
+
+        if (nbItems > maxItems) {
+            nbItems = maxItems;
+        }
+
+        for (unsigned int i = 0; i < nbItems; i++) {
+            items[i] = m_items[(tail + i) & m_mask];
+        }
+
+        __atomic_store_n(&m_tail, tail + nbItems, __ATOMIC_RELEASE);
+        return nbItems;
+    }
+
+    /** Number of items in the queue. Exact only from the producer or consumer thread when the other is idle */
+    unsigned int size() const
+    {
+        return __atomic_load_n(&m_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&m_tail, __ATOMIC_ACQUIRE);
+    }
+
+    unsigned int capacity() const { return m_capacity; }
+
+private:
+    SPSCQueue(const SPSCQueue&);
+    SPSCQueue& operator=(const SPSCQueue&);
+
+    unsigned int m_head;         //!< next item to write. Written by the producer only
+    char m_padHead[64 - sizeof(unsigned int)]; //!< keep producer and consumer indexes on separate cache lines
+    unsigned int m_tail;         //!< next item to read. Written by the consumer only
+    char m_padTail[64 - sizeof(unsigned int)];
+    unsigned int m_capacity;
+    unsigned int m_mask;
+    T *m_items;
+};
+
+} // namespace DSDcc
+
+#endif /* SPSCQUEUE_H_ */
@@ -19,8 +19,98 @@
 #include <iostream>
 #include <iomanip>
 #include <string.h>
+#include <stdlib.h>
 #include "../crc.h"
 
+// D-Star FCS the original way: bit by bit LSB first
+unsigned int dstarFCS(const unsigned char *array, int size)
+{
+    unsigned int crc = 0xffff;
+
+    for (int n = 0; n < size; n++)
+    {
+        for (int m = 0; m < 8; m++)
+        {
+            crc ^= (array[n] >> m) & 1;
+            crc = (crc & 1) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+        }
+    }
+
+    return crc ^ 0xffff;
+}
+
+// dPMR CRC the original way: polynomial division of a bit per byte array. poly has the X^order term
+unsigned int dpmrCRC(const unsigned char *bits, int nbBits, const unsigned char *poly, int order)
+{
+    unsigned char work[128];
+    memcpy(work, bits, nbBits);
+    memset(&work[nbBits], 0, order);
+
+    for (int i = 0; i < nbBits; i++)
+    {
+        if (work[i] == 1)
+        {
+            for (int j = 0; j <= order; j++) {
+                work[i+j] ^= poly[j];
+            }
+        }
+    }
+
+    unsigned int crc = 0;
+
+    for (int i = 0; i < order; i++) {
+        crc = (crc << 1) + work[nbBits + i];
+    }
+
+    return crc;
+}
+
+// Compares the table driven CRCs with the previous implementations on random data
+bool testEngine()
+{
+    DSDcc::CRC crcYSF(DSDcc::CRC::PolyCCITT16, 16, 0x0, 0xffff);
+    DSDcc::CRC crcDStar(DSDcc::CRC::PolyCCITT16, 16, 0xffff, 0xffff, 1, 1, 1);
+    DSDcc::CRC crc7(DSDcc::CRC::PolyDPMR7, 7, 0, 0);
+    DSDcc::CRC crc8(DSDcc::CRC::PolyDPMR8, 8, 0, 0);
+    const unsigned char poly7[8] = {1, 0, 0, 0, 1, 0, 0, 1};
+    const unsigned char poly8[9] = {1, 0, 0, 0, 0, 0, 1, 1, 1};
+    unsigned char bytes[100], bits[800];
+    int ysfKO = 0, dstarKO = 0, dpmrKO = 0;
+
+    srand(0);
+
+    for (int len = 0; len < 100; len++)
+    {
+        for (int i = 0; i < len; i++) {
+            bytes[i] = rand() & 0xff;
+        }
+
+        for (int i = 0; i < 8*len; i++) {
+            bits[i] = (bytes[i/8] >> (7 - (i%8))) & 1;
+        }
+
+        if ((crcYSF.crcbits(bits, 8*len) != crcYSF.crcbitbybitfast(bytes, len))
+         || (crcYSF.crctablefast(bytes, len) != crcYSF.crcbitbybitfast(bytes, len))) {
+            ysfKO++;
+        }
+
+        if (crcDStar.crctablefast(bytes, len) != dstarFCS(bytes, len)) {
+            dstarKO++;
+        }
+
+        if ((crc7.crcbits(bits, len) != dpmrCRC(bits, len, poly7, 7))
+         || (crc8.crcbits(bits, len) != dpmrCRC(bits, len, poly8, 8))) {
+            dpmrKO++;
+        }
+    }
+
+    std::cout << "CCITT16 slicing and bits vs bit by bit: " << (ysfKO ? "*KO*" : "OK") << std::endl;
+    std::cout << "D-Star FCS vs bit by bit LSB first    : " << (dstarKO ? "*KO*" : "OK") << std::endl;
+    std::cout << "dPMR CRC7 and CRC8 vs array division  : " << (dpmrKO ? "*KO*" : "OK") << std::endl;
+
+    return !ysfKO && !dstarKO && !dpmrKO;
+}
+
 void testYSF(DSDcc::CRC& crc, const unsigned char *bytes, const char *comment, const unsigned int crcCorrect)
 {
     unsigned long ret_crcbitbybit     = crc.crcbitbybit((unsigned char *)bytes, 4);
@@ -173,5 +263,8 @@ int main(int argc, char *argv[])
 
     std::cout << ((int) strlen(dstarCRCGPS_2) - 11) << std::endl;
 
+    std::cout << std::endl;
+    testEngine();
+
     return 0;
 }
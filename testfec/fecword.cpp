@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Checks the word based FEC methods against the bit per byte ones
+// Usage: fecword
+
+#include <iostream>
+#include "../fec.h"
+
+using namespace DSDcc;
+
+static int popcount(uint32_t x)
+{
+    int n = 0;
+
+    for (; x; x &= x - 1) {
+        n++;
+    }
+
+    return n;
+}
+
+/**
+ * For all data words encodeWord must give the same codeword as encode. For a sample of data words
+ * all error patterns of up to maxErrors bits must be corrected. The syndrome tables only list errors
+ * on the data bits so errors are only applied to the correctableBits first bits.
+ */
+template<typename Code>
+bool check(const char *name, int n, int k, int maxErrors, int correctableBits)
+{
+    Code code;
+    int nbFailures = 0;
+    unsigned char dataBits[24], codeBits[24];
+
+    for (uint32_t data = 0; data < (1U << k); data++)
+    {
+        FECBits::unpack(data, dataBits, k);
+        code.encode(dataBits, codeBits);
+        uint32_t codeword = Code::encodeWord(data);
+
+        if (codeword != FECBits::pack(codeBits, n)) {
+            nbFailures++;
+        }
+
+        if ((data % 29) != 0) {
+            continue;
+        }
+
+        for (uint32_t error = 0; error < (1U << correctableBits); error++)
+        {
+            int nbErrors = popcount(error);
+
+            if (nbErrors > maxErrors) {
+                continue;
+            }
+
+            uint32_t decoded = ~data;
+
+            if ((Code::decodeWord(codeword ^ (error << (n - correctableBits)), decoded) != nbErrors) || (decoded != data)) {
+                nbFailures++;
+            }
+        }
+    }
+
+    std::cout << name << ": " << (nbFailures == 0 ? "OK" : "*KO*") << std::endl;
+    return nbFailures == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    ok = check<Hamming_7_4>("Hamming (7,4)", 7, 4, 1, 4) && ok;
+    ok = check<Hamming_12_8>("Hamming (12,8)", 12, 8, 1, 8) && ok;
+    ok = check<Hamming_15_11>("Hamming (15,11)", 15, 11, 1, 11) && ok;
+    ok = check<Hamming_16_11_4>("Hamming (16,11,4)", 16, 11, 1, 11) && ok;
+    ok = check<Golay_20_8>("Golay (20,8)", 20, 8, 3, 8) && ok;
+    ok = check<Golay_23_12>("Golay (23,12)", 23, 12, 3, 11) && ok; // table does not cover the last data bit
+    ok = check<Golay_24_12>("Golay (24,12)", 24, 12, 3, 12) && ok;
+    ok = check<QR_16_7_6>("QR (16,7,6)", 16, 7, 2, 7) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Decodes sample files with floating point and fixed point filters and compares the DV frames obtained
+// Usage: fixedpoint
+
+#include <iostream>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+#include "../dsd_decoder.h"
+
+struct SampleFile
+{
+    const char *m_fileName;
+    DSDcc::DSDDecoder::DSDDecodeMode m_decodeMode;
+};
+
+static const SampleFile sampleFiles[] = {
+    {"../samples/dmr_it_8.dis", DSDcc::DSDDecoder::DSDDecodeDMR},
+    {"../samples/dpmr.dis", DSDcc::DSDDecoder::DSDDecodeDPMR},
+    {"../samples/dstar_f1zil_1.dis", DSDcc::DSDDecoder::DSDDecodeDStar},
+    {"../samples/dstar_f1zil_2.dis", DSDcc::DSDDecoder::DSDDecodeDStar},
+    {0, DSDcc::DSDDecoder::DSDDecodeNone}
+};
+
+void decode(const char *fileName, DSDcc::DSDDecoder::DSDDecodeMode decodeMode,
+        DSDcc::DSDFilters::DSDFilterArithmetic arithmetic, std::vector<DSDcc::DSDDecoder::DSDDVFrame>& dvFrames)
+{
+    DSDcc::DSDDecoder dsdDecoder(arithmetic);
+    short samples[4800];
+    size_t nbSamples;
+    FILE *fp = fopen(fileName, "rb");
+
+    if (!fp)
+    {
+        std::cout << "cannot open " << fileName << std::endl;
+        return;
+    }
+
+    dsdDecoder.setQuiet();
+    dsdDecoder.setLogVerbosity(0);
+    dsdDecoder.enableMbelib(false);
+    dsdDecoder.setDecodeMode(DSDcc::DSDDecoder::DSDDecodeNone, true);
+    dsdDecoder.setDecodeMode(decodeMode, true);
+
+    while ((nbSamples = fread(samples, sizeof(short), 4800, fp)) > 0)
+    {
+        DSDcc::DSDDecoder::DSDDVFrame frames[DSD_DVFRAME_QUEUE_SIZE];
+        dsdDecoder.runBlock(samples, nbSamples);
+
+        for (int slot = 0; slot < 2; slot++)
+        {
+            int nbFrames = dsdDecoder.popDVFrames(slot, frames, DSD_DVFRAME_QUEUE_SIZE);
+            dvFrames.insert(dvFrames.end(), frames, frames + nbFrames);
+        }
+    }
+
+    fclose(fp);
+}
+
+int countBitErrors(const DSDcc::DSDDecoder::DSDDVFrame& frame1, const DSDcc::DSDDecoder::DSDDVFrame& frame2)
+{
+    int nbErrors = 0;
+
+    for (int i = 0; i < 18; i++)
+    {
+        unsigned char x = frame1.m_frame[i] ^ frame2.m_frame[i];
+
+        for (; x; x >>= 1) {
+            nbErrors += x & 1;
+        }
+    }
+
+    return nbErrors;
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    for (int i = 0; sampleFiles[i].m_fileName; i++)
+    {
+        std::vector<DSDcc::DSDDecoder::DSDDVFrame> floatFrames, fixedFrames;
+        decode(sampleFiles[i].m_fileName, sampleFiles[i].m_decodeMode, DSDcc::DSDFilters::DSDFilterFloat, floatFrames);
+        decode(sampleFiles[i].m_fileName, sampleFiles[i].m_decodeMode, DSDcc::DSDFilters::DSDFilterFixedPoint, fixedFrames);
+
+        int nbBits = 0;
+        int nbErrors = 0;
+
+        for (unsigned int j = 0; (j < floatFrames.size()) && (j < fixedFrames.size()); j++)
+        {
+            nbErrors += countBitErrors(floatFrames[j], fixedFrames[j]);
+            nbBits += 18*8;
+        }
+
+        bool fileOk = (floatFrames.size() > 0) && (floatFrames.size() == fixedFrames.size()) && (nbErrors == 0);
+        ok = ok && fileOk;
+
+        std::cout << sampleFiles[i].m_fileName << ": float: " << floatFrames.size() << " frames fixed point: " << fixedFrames.size()
+                << " frames bit errors: " << nbErrors << "/" << nbBits << (fileOk ? " OK" : " *KO*") << std::endl;
+    }
+
+    return ok ? 0 : 1;
+}
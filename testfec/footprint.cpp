@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Checks the memory footprint of a decoder against DSD_DECODER_SIZE_TARGET
+// Usage: footprint
+
+#include <iostream>
+#include "../dsd_decoder.h"
+
+int main(int argc, char *argv[])
+{
+    bool ok = sizeof(DSDcc::DSDDecoder) <= DSD_DECODER_SIZE_TARGET;
+
+    std::cout << "DSDDecoder:    " << sizeof(DSDcc::DSDDecoder) << " bytes target " << DSD_DECODER_SIZE_TARGET << (ok ? " OK" : " *KO*") << std::endl;
+    std::cout << "DSDMBEDecoder: " << sizeof(DSDcc::DSDMBEDecoder) << " bytes" << std::endl;
+    std::cout << "DSDSymbol:     " << sizeof(DSDcc::DSDSymbol) << " bytes" << std::endl;
+    std::cout << "DSDDMR:        " << sizeof(DSDcc::DSDDMR) << " bytes" << std::endl;
+    std::cout << "DSDYSF:        " << sizeof(DSDcc::DSDYSF) << " bytes" << std::endl;
+    std::cout << "DSDDstar:      " << sizeof(DSDcc::DSDDstar) << " bytes" << std::endl;
+    std::cout << "DSDState:      " << sizeof(DSDcc::DSDState) << " bytes" << std::endl;
+
+    // syndrome tables are shared and audio buffers are only allocated when audio is produced
+    DSDcc::DSDDecoder *decoders[4];
+    bool audioOk = true;
+
+    for (int i = 0; i < 4; i++)
+    {
+        int nbSamples;
+        decoders[i] = new DSDcc::DSDDecoder();
+        audioOk = audioOk && (decoders[i]->getAudio1(nbSamples) == 0) && (nbSamples == 0);
+        audioOk = audioOk && (decoders[i]->getAudio2(nbSamples) == 0) && (nbSamples == 0);
+    }
+
+    for (int i = 0; i < 4; i++) {
+        delete decoders[i];
+    }
+
+    std::cout << "Audio buffers not allocated before use:" << (audioOk ? " OK" : " *KO*") << std::endl;
+
+    return (ok && audioOk) ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Pushes frames from one thread and drains them from another through the lock free
+// queue and the asynchronous MBE synthesis. Checks that frames come out in order and
+// that none is lost
+// Usage: mbequeue
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <iostream>
+
+#include "../spscqueue.h"
+#include "../dsd_decoder.h"
+#include "../dsd_mbe.h"
+
+static const unsigned int nbFrames = 200000;
+
+struct TestFrame
+{
+    unsigned int m_seq;
+    char m_ambe_fr[4][24]; //!< filled with the sequence number low byte
+};
+
+static DSDcc::SPSCQueue<TestFrame> testQueue(64);
+
+static void *queueProducer(void *)
+{
+    TestFrame frame;
+
+    for (unsigned int seq = 0; seq < nbFrames; seq++)
+    {
+        frame.m_seq = seq;
+        memset(frame.m_ambe_fr, seq & 0xFF, sizeof(frame.m_ambe_fr));
+
+        while (!testQueue.push(frame)) { // full: wait for the consumer
+            sched_yield();
+        }
+    }
+
+    return 0;
+}
+
+static bool checkQueue()
+{
+    pthread_t producer;
+    pthread_create(&producer, 0, queueProducer, 0);
+
+    TestFrame frames[16];
+    unsigned int expected = 0;
+    unsigned int nbErrors = 0;
+    bool batch = false;
+
+    while (expected < nbFrames)
+    {
+        unsigned int nbPopped = batch ? testQueue.pop(frames, 16) : (testQueue.pop(frames[0]) ? 1 : 0);
+        batch = !batch; // alternate single and batch pops
+
+        if (nbPopped == 0) {
+            sched_yield();
+        }
+
+        for (unsigned int i = 0; i < nbPopped; i++, expected++)
+        {
+            if ((frames[i].m_seq != expected) || (frames[i].m_ambe_fr[3][23] != (char) (expected & 0xFF))) {
+                nbErrors++;
+            }
+        }
+    }
+
+    pthread_join(producer, 0);
+    bool ok = (nbErrors == 0) && (testQueue.size() == 0);
+    std::cout << "SPSCQueue: " << expected << " frames " << nbErrors << " out of order: " << (ok ? "OK" : "*KO*") << std::endl;
+    return ok;
+}
+
+static DSDcc::DSDDecoder dsdDecoder;
+static DSDcc::DSDMBEDecoder mbeDecoder(&dsdDecoder);
+static unsigned int nbSynthesized = 0;
+static bool producerDone = false;
+
+static void *synthesisThread(void *)
+{
+    while (true)
+    {
+        bool done = __atomic_load_n(&producerDone, __ATOMIC_ACQUIRE); // read before the last drain
+        int nb = mbeDecoder.synthesizeQueued();
+
+        if (nb > 0) {
+            __atomic_fetch_add(&nbSynthesized, nb, __ATOMIC_RELEASE);
+        } else if (done) {
+            return 0;
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+static bool checkAsyncSynthesis()
+{
+    char imbe_fr[8][23], ambe_fr[4][24], imbe7100_fr[7][24];
+    memset(imbe_fr, 0, sizeof(imbe_fr));
+    memset(ambe_fr, 0, sizeof(ambe_fr));
+    memset(imbe7100_fr, 0, sizeof(imbe7100_fr));
+
+    mbeDecoder.setAsync(true);
+    pthread_t synthesis;
+    pthread_create(&synthesis, 0, synthesisThread, 0);
+
+    for (unsigned int sent = 0; sent < nbFrames / 10; )
+    {
+        for (int i = 0; i < 32; i++, sent++) { // half the queue then wait for the drain as a real time source would
+            mbeDecoder.processFrame(imbe_fr, ambe_fr, imbe7100_fr);
+        }
+
+        while (__atomic_load_n(&nbSynthesized, __ATOMIC_ACQUIRE) < sent) {
+            sched_yield();
+        }
+    }
+
+    __atomic_store_n(&producerDone, true, __ATOMIC_RELEASE);
+    pthread_join(synthesis, 0);
+
+    bool ok = (nbSynthesized == nbFrames / 10) && (mbeDecoder.getNbDroppedFrames() == 0);
+    std::cout << "Asynchronous synthesis: " << nbSynthesized << " frames " << mbeDecoder.getNbDroppedFrames() << " dropped: "
+            << (ok ? "OK" : "*KO*") << std::endl;
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    ok = checkQueue() && ok;
+    ok = checkAsyncSynthesis() && ok;
+
+    return ok ? 0 : 1;
+}
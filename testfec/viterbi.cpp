@@ -101,7 +101,7 @@ void testMIT()
 	std::cout << "Test (MIT) K=3 N=2 Polys={1+x+x^2, 1+x}" << std::endl;
 	std::cout << "---------------------------------------" << std::endl;
 
-	DSDcc::Viterbi viterbi23(3, 2, DSDcc::Viterbi::Poly23);
+	DSDcc::ViterbiK<3, 2> viterbi23(DSDcc::Viterbi::Poly23);
 	const unsigned char *codes = viterbi23.getBranchCodes();
 
 	if (memcmp(codes, mitCodewords, 8) == 0)
@@ -237,7 +237,7 @@ void testViterbiLegacy()
 	std::cout << "------------------------------------" << std::endl;
 	std::cout << "-- test new Viterbi class --" << std::endl;
 
-	DSDcc::Viterbi viterbi(3, 2, DSDcc::Viterbi::Poly23a, false); // false = dibit coding is LSB first for D-Star
+	DSDcc::ViterbiK<3, 2> viterbi(DSDcc::Viterbi::Poly23a, false); // false = dibit coding is LSB first for D-Star
 
     bitify(bitsPh, text, 41);
     bitsPh[328] = 0;
@@ -374,7 +374,7 @@ void testDStar()
 	std::cout << "Test (D-Star) K=3 N=2 Polys={1+x+x^2, 1+x^2}" << std::endl;
 	std::cout << "--------------------------------------------" << std::endl;
 
-	DSDcc::Viterbi viterbi23a(3, 2, DSDcc::Viterbi::Poly23a);
+	DSDcc::ViterbiK<3, 2> viterbi23a(DSDcc::Viterbi::Poly23a);
 
 	testViterbi(viterbi23a);
 
@@ -386,7 +386,7 @@ void test24()
 	std::cout << "Test K=4 N=2 with Polys={1+x+x^2+x^3, 1+x^2+x^3}" << std::endl;
 	std::cout << "------------------------------------------------" << std::endl;
 
-	DSDcc::Viterbi viterbi24(4, 2, DSDcc::Viterbi::Poly24);
+	DSDcc::ViterbiK<4, 2> viterbi24(DSDcc::Viterbi::Poly24);
 
 	testViterbi(viterbi24);
 
@@ -398,7 +398,7 @@ void test25()
 	std::cout << "Test K=5 N=2 with Polys={1+x^2+x^3+x^4, 1+x+x^4}" << std::endl;
 	std::cout << "------------------------------------------------" << std::endl;
 
-	DSDcc::Viterbi viterbi25(5, 2, DSDcc::Viterbi::Poly25);
+	DSDcc::ViterbiK<5, 2> viterbi25(DSDcc::Viterbi::Poly25);
 
 	testViterbi(viterbi25);
 
@@ -410,7 +410,7 @@ void testYSF()
 	std::cout << "Test (YSF) K=5 N=2 Polys={1+x^3+x^4, 1+x+x^2+X^4}" << std::endl;
 	std::cout << "-------------------------------------------------" << std::endl;
 
-	DSDcc::Viterbi viterbi25y(5, 2, DSDcc::Viterbi::Poly25y);
+	DSDcc::ViterbiK<5, 2> viterbi25y(DSDcc::Viterbi::Poly25y);
 
 	testViterbi(viterbi25y);
 
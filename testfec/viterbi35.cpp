@@ -102,7 +102,7 @@ void testMIT()
 	std::cout << "Test (MIT) K=3 N=2 Polys={1+x+x^2, 1+x}" << std::endl;
 	std::cout << "---------------------------------------" << std::endl;
 
-    DSDcc::Viterbi3 viterbi(2, DSDcc::Viterbi::Poly23);
+    DSDcc::Viterbi3 viterbi(DSDcc::Viterbi::Poly23);
 	const unsigned char *codes = viterbi.getBranchCodes();
 
 	if (memcmp(codes, mitCodewords, 8) == 0)
@@ -233,7 +233,7 @@ void testViterbiLegacy()
 	std::cout << "------------------------------------" << std::endl;
 	std::cout << "-- test new Viterbi class --" << std::endl;
 
-	DSDcc::Viterbi3 viterbi(2, DSDcc::Viterbi::Poly23a, false); // false = dibit coding is LSB first for D-Star
+	DSDcc::Viterbi3 viterbi(DSDcc::Viterbi::Poly23a, false); // false = dibit coding is LSB first for D-Star
 
     bitify(bitsPh, text, 41);
     bitsPh[328] = 0;
@@ -371,6 +371,46 @@ void testViterbi(DSDcc::Viterbi& viterbi)
     decodedText[43] = '\0';
 
     std::cout << "Phrase: " << decodedText << std::endl;
+
+    // ================================================================
+    std::cout << "-- Test #3 --" << std::endl;
+    // ================================================================
+
+    int n = viterbi.getN();
+    unsigned char *softBitsPh = new unsigned char[44*8*n];
+    unsigned char *hardBitsPh = new unsigned char[44*8*n];
+
+    viterbi.encodeToSymbols(symbolsPh, bitsPh, 44*8, 0);
+
+    for (int i = 0; i < 44*8; i++)
+    {
+        for (int j = 0; j < n; j++) {
+            softBitsPh[i*n + j] = (symbolsPh[i]>>j) & 1 ? 15 : 0; // same bit order as decodeFromBits
+        }
+
+        if (i%2 == 1) { // one weak wrong bit every other symbol
+            softBitsPh[i*n] = softBitsPh[i*n] ? 6 : 9;
+        }
+    }
+
+    for (int i = 0; i < 44*8*n; i++) {
+        hardBitsPh[i] = softBitsPh[i] >> 3;
+    }
+
+    viterbi.decodeFromBits(decodedBitsPh, hardBitsPh, 44*8*n, 0);
+    std::cout << "Hard decision phrase: " << (memcmp(decodedBitsPh, bitsPh, 43*8) == 0 ? "OK" : "KO") << std::endl;
+
+    ts = getUSecs();
+    viterbi.decodeFromSoftBits(decodedBitsPh, softBitsPh, 44*8*n, 0);
+    usecs = getUSecs() - ts;
+    std::cout << "Soft phrase decoded: in " << usecs << " microseconds" << std::endl;
+
+    charify(decodedText, decodedBitsPh, 44*8);
+    decodedText[43] = '\0';
+    std::cout << "Soft phrase: " << decodedText << (memcmp(decodedBitsPh, bitsPh, 43*8) == 0 ? " OK" : " KO") << std::endl;
+
+    delete[] hardBitsPh;
+    delete[] softBitsPh;
     std::cout << std::endl;
 }
 
@@ -379,7 +419,7 @@ void testDStar()
 	std::cout << "Test (D-Star) K=3 N=2 Polys={1+x+x^2, 1+x^2}" << std::endl;
 	std::cout << "--------------------------------------------" << std::endl;
 
-	DSDcc::Viterbi3 viterbi(2, DSDcc::Viterbi::Poly23a);
+	DSDcc::Viterbi3 viterbi(DSDcc::Viterbi::Poly23a);
 
 	testViterbi(viterbi);
 
@@ -391,7 +431,7 @@ void test25()
 	std::cout << "Test K=5 N=2 with Polys={1+x^2+x^3+x^4, 1+x+x^4}" << std::endl;
 	std::cout << "------------------------------------------------" << std::endl;
 
-	DSDcc::Viterbi5 viterbi25(2, DSDcc::Viterbi::Poly25);
+	DSDcc::Viterbi5 viterbi25(DSDcc::Viterbi::Poly25);
 
 	testViterbi(viterbi25);
 
@@ -403,7 +443,7 @@ void testYSF()
 	std::cout << "Test (YSF) K=5 N=2 Polys={1+x^3+x^4, 1+x+x^2+X^4}" << std::endl;
 	std::cout << "-------------------------------------------------" << std::endl;
 
-	DSDcc::Viterbi5 viterbi25y(2, DSDcc::Viterbi::Poly25y);
+	DSDcc::Viterbi5 viterbi25y(DSDcc::Viterbi::Poly25y);
 
 	testViterbi(viterbi25y);
 
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Counts the heap allocations made while decoding D-Star headers and YSF FICH and DCH
+// with the Viterbi decoders set up as in the D-Star and YSF decoders
+// Usage: viterbialloc
+
+#include <stdlib.h>
+#include <iostream>
+#include <new>
+
+#include "../viterbi3.h"
+#include "../viterbi5.h"
+
+static unsigned int nbAllocations = 0;
+
+void *operator new(size_t size)
+{
+    nbAllocations++;
+    void *p = malloc(size ? size : 1);
+
+    if (!p) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) throw()
+{
+    free(p);
+}
+
+void operator delete[](void *p) throw()
+{
+    free(p);
+}
+
+static void makeSoftBits(DSDcc::Viterbi& viterbi, unsigned char *softBits, int nbSymbols)
+{
+    unsigned char dataBits[512], codedBits[1024];
+
+    for (int i = 0; i < nbSymbols; i++) {
+        dataBits[i] = (i < nbSymbols - viterbi.getK() + 1) ? rand() & 1 : 0;
+    }
+
+    viterbi.encodeToBits(codedBits, dataBits, nbSymbols, 0);
+
+    for (int i = 0; i < viterbi.getN() * nbSymbols; i++) {
+        softBits[i] = (rand() % 10 == 0) ? rand() % 16 : codedBits[i] * 15;
+    }
+}
+
+static bool check(const char *name, DSDcc::Viterbi& viterbi, int nbSymbols, unsigned int expected)
+{
+    unsigned char softBits[1024], hardBits[1024], dataBits[512];
+    makeSoftBits(viterbi, softBits, nbSymbols);
+
+    for (int i = 0; i < viterbi.getN() * nbSymbols; i++) {
+        hardBits[i] = softBits[i] > 7 ? 1 : 0;
+    }
+
+    unsigned int nbAllocationsStart = nbAllocations;
+
+    for (int i = 0; i < 100; i++)
+    {
+        viterbi.decodeFromSoftBits(dataBits, softBits, viterbi.getN() * nbSymbols, 0);
+        viterbi.decodeFromBits(dataBits, hardBits, viterbi.getN() * nbSymbols, 0);
+    }
+
+    unsigned int count = nbAllocations - nbAllocationsStart;
+    std::cout << name << ": " << count << " allocations: " << (count == expected ? "OK" : "*KO*") << std::endl;
+    return count == expected;
+}
+
+int main(int argc, char *argv[])
+{
+    bool ok = true;
+
+    DSDcc::Viterbi3 viterbiDStar(DSDcc::Viterbi::Poly23a, false, 330);
+    DSDcc::Viterbi5 viterbiYSF(DSDcc::Viterbi::Poly25y, true, 180);
+
+    ok = check("D-Star header", viterbiDStar, 330, 0) && ok;
+    ok = check("YSF FICH", viterbiYSF, 100, 0) && ok;
+    ok = check("YSF DCH", viterbiYSF, 180, 0) && ok;
+
+    DSDcc::Viterbi5 viterbiLazy(DSDcc::Viterbi::Poly25y, true);
+
+    ok = check("YSF DCH without reserve", viterbiLazy, 180, 1) && ok; // path memory allocated on first use only
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,486 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+// Decodes a sample file and compares the trace of the decoder outputs to a golden file.
+// The trace lists the DV frames bytes with the index of the input sample that completed them
+// and, every GOLDEN_PERIOD_SAMPLES samples, the changes of: sync type, DMR slot texts, D-Star
+// header fields, dPMR identifiers, YSF FICH and callsigns. Outputs are only collected at these
+// period boundaries so that decoding sample by sample with run() or by blocks with runBlock()
+// must give the same trace. The frames bytes are only stored with mbelib disabled so the trace
+// is made with mbelib disabled.
+// With -a the decoding is made with mbelib enabled instead and the trace is the number of audio
+// samples and their hash for each slot, compared to the <sample name>.audio.golden file.
+// Usage: golden [-u] [-b] [-i] [-a] [-A] [-o trace file] <samples directory> <golden directory> <sample name>
+//   -u updates the golden file with the trace instead of comparing
+//   -b decodes by blocks with runBlock() instead of run()
+//   -i uses fixed point filters compared to the <sample name>.fixed[.audio].golden file
+//   -a checks the audio (needs mbelib)
+//   -A checks the audio with asynchronous synthesis run at the end of each period
+// Exits with 0 if the trace matches and 1 if it differs or the sample or golden file is missing.
+// Audio checks exit with 77 (skipped) when mbelib is not compiled in or the audio golden file
+// is missing as it can only be made on a system with mbelib
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "dsd_decoder.h"
+
+#define GOLDEN_SKIP 77 // audio checks only
+#define GOLDEN_PERIOD_SAMPLES 480 // 10ms
+
+struct GoldenMode
+{
+    const char *m_prefix;
+    DSDcc::DSDDecoder::DSDDecodeMode m_mode;
+    DSDcc::DSDDecoder::DSDRate m_rate;
+};
+
+// longest prefixes first
+static const GoldenMode goldenModes[] = {
+    {"dpmr",  DSDcc::DSDDecoder::DSDDecodeDPMR,  DSDcc::DSDDecoder::DSDRate2400},
+    {"dmr",   DSDcc::DSDDecoder::DSDDecodeDMR,   DSDcc::DSDDecoder::DSDRate4800},
+    {"dstar", DSDcc::DSDDecoder::DSDDecodeDStar, DSDcc::DSDDecoder::DSDRate4800},
+    {"ysf",   DSDcc::DSDDecoder::DSDDecodeYSF,   DSDcc::DSDDecoder::DSDRate4800},
+};
+
+class GoldenTrace
+{
+public:
+    GoldenTrace(DSDcc::DSDDecoder& dsdDecoder) :
+        m_dsdDecoder(dsdDecoder),
+        m_syncType(-1)
+    {}
+
+    void update(unsigned long sampleIndex); //!< at the end of each period
+    const std::string& getText() const { return m_text; }
+
+private:
+    static bool frameBefore(const DSDcc::DSDDecoder::DSDDVFrame& a, const DSDcc::DSDDecoder::DSDDVFrame& b);
+    void changed(unsigned long sampleIndex, const char *field, std::string& last, const std::string& value);
+    void popFrames();
+
+    DSDcc::DSDDecoder& m_dsdDecoder;
+    int m_syncType;
+    std::string m_dmrSlot0;
+    std::string m_dmrSlot1;
+    std::string m_dstarHeader;
+    std::string m_dpmrIds;
+    std::string m_ysfFICH;
+    std::string m_ysfCallsigns;
+    std::string m_text;
+};
+
+void GoldenTrace::changed(unsigned long sampleIndex, const char *field, std::string& last, const std::string& value)
+{
+    std::string trimmed(value, 0, value.find_last_not_of(' ') + 1); // padded texts
+
+    if (trimmed != last)
+    {
+        std::ostringstream os;
+        os << sampleIndex << " " << field << " " << trimmed << "\n";
+        m_text += os.str();
+        last = trimmed;
+    }
+}
+
+void GoldenTrace::update(unsigned long sampleIndex)
+{
+    popFrames(); // all completed before the state observed now
+
+    if (m_dsdDecoder.getSyncType() != m_syncType)
+    {
+        std::ostringstream os;
+        m_syncType = m_dsdDecoder.getSyncType();
+        os << sampleIndex << " sync " << m_syncType << "\n";
+        m_text += os.str();
+    }
+
+    changed(sampleIndex, "dmr0", m_dmrSlot0, m_dsdDecoder.getDMRDecoder().getSlot0Text());
+    changed(sampleIndex, "dmr1", m_dmrSlot1, m_dsdDecoder.getDMRDecoder().getSlot1Text());
+
+    const DSDcc::DSDDstar& dstar = m_dsdDecoder.getDStarDecoder();
+    changed(sampleIndex, "dstar", m_dstarHeader, dstar.getMySign() + ">" + dstar.getYourSign() + " " + dstar.getRpt1() + ">" + dstar.getRpt2());
+
+    std::ostringstream dpmr;
+    dpmr << m_dsdDecoder.getDPMRDecoder().getOwnId() << ">" << m_dsdDecoder.getDPMRDecoder().getCalledId()
+            << " CC " << m_dsdDecoder.getDPMRDecoder().getColorCode();
+    changed(sampleIndex, "dpmr", m_dpmrIds, dpmr.str());
+
+    const DSDcc::DSDYSF& ysf = m_dsdDecoder.getYSFDecoder();
+    std::ostringstream fich;
+    fich << ysf.getFICH();
+    changed(sampleIndex, "ysffich", m_ysfFICH, fich.str());
+    changed(sampleIndex, "ysf", m_ysfCallsigns, std::string(ysf.getSrc()) + ">" + ysf.getDest() + " " + ysf.getUplink() + ">" + ysf.getDownlink());
+}
+
+bool GoldenTrace::frameBefore(const DSDcc::DSDDecoder::DSDDVFrame& a, const DSDcc::DSDDecoder::DSDDVFrame& b)
+{
+    return (a.m_timestamp < b.m_timestamp) || ((a.m_timestamp == b.m_timestamp) && (a.m_slot < b.m_slot));
+}
+
+/** Both slots frames in order of production */
+void GoldenTrace::popFrames()
+{
+    DSDcc::DSDDecoder::DSDDVFrame slotFrames[DSD_DVFRAME_QUEUE_SIZE];
+    std::vector<DSDcc::DSDDecoder::DSDDVFrame> frames;
+
+    for (int slot = 0; slot < 2; slot++)
+    {
+        int nbFrames = m_dsdDecoder.popDVFrames(slot, slotFrames, DSD_DVFRAME_QUEUE_SIZE);
+        frames.insert(frames.end(), slotFrames, slotFrames + nbFrames);
+    }
+
+    std::stable_sort(frames.begin(), frames.end(), frameBefore);
+
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        char hex[4];
+        int nbBytes = (frames[i].m_mbeRate == DSDcc::DSDDecoder::DSDMBERate7200x4400)
+                || (frames[i].m_mbeRate == DSDcc::DSDDecoder::DSDMBERate7100x4400) ? 18 : 9; // IMBE or AMBE
+        std::ostringstream os;
+        os << frames[i].m_timestamp << " dv" << frames[i].m_slot << " " << frames[i].m_seq
+                << " rate " << (int) frames[i].m_mbeRate << " fec " << frames[i].m_fecErrors << " ";
+
+        for (int j = 0; j < nbBytes; j++)
+        {
+            snprintf(hex, sizeof(hex), "%02x", frames[i].m_frame[j]);
+            os << hex;
+        }
+
+        os << "\n";
+        m_text += os.str();
+    }
+}
+
+/** FNV-1a hash of the audio samples of one slot */
+class AudioHash
+{
+public:
+    AudioHash() : m_nbSamples(0), m_hash(14695981039346656037ULL) {}
+
+    void update(const short *samples, int nbSamples)
+    {
+        for (int i = 0; i < nbSamples; i++)
+        {
+            unsigned short sample = (unsigned short) samples[i];
+            m_hash = (m_hash ^ (sample & 0xFF)) * 1099511628211ULL;
+            m_hash = (m_hash ^ (sample >> 8)) * 1099511628211ULL;
+        }
+
+        m_nbSamples += nbSamples;
+    }
+
+    unsigned long m_nbSamples;
+    unsigned long long m_hash;
+};
+
+/** Takes the audio produced in the period. Synthesizes the queued frames first in asynchronous mode */
+static void collectAudio(DSDcc::DSDDecoder& dsdDecoder, AudioHash audioHashes[2])
+{
+    int nbSamples;
+    short *audio;
+
+    if (dsdDecoder.isMbeAsync()) {
+        dsdDecoder.synthesizeAudio();
+    }
+
+    audio = dsdDecoder.getAudio1(nbSamples);
+    audioHashes[0].update(audio, nbSamples);
+    dsdDecoder.resetAudio1();
+    audio = dsdDecoder.getAudio2(nbSamples);
+    audioHashes[1].update(audio, nbSamples);
+    dsdDecoder.resetAudio2();
+}
+
+static bool readFile(const std::string& path, std::string& text)
+{
+    FILE *fp = fopen(path.c_str(), "rb");
+
+    if (!fp) {
+        return false;
+    }
+
+    char buffer[4096];
+    size_t nbRead;
+
+    while ((nbRead = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+        text.append(buffer, nbRead);
+    }
+
+    fclose(fp);
+    return true;
+}
+
+static bool writeFile(const std::string& path, const std::string& text)
+{
+    FILE *fp = fopen(path.c_str(), "wb");
+
+    if (!fp) {
+        return false;
+    }
+
+    fwrite(text.data(), 1, text.size(), fp);
+    fclose(fp);
+    return true;
+}
+
+static void splitLines(const std::string& text, std::vector<std::string>& lines)
+{
+    std::istringstream is(text);
+    std::string line;
+
+    while (std::getline(is, line)) {
+        lines.push_back(line);
+    }
+}
+
+/** Prints the first differing lines. Returns the number of differences */
+static int compare(const std::string& golden, const std::string& trace)
+{
+    std::vector<std::string> goldenLines, traceLines;
+    splitLines(golden, goldenLines);
+    splitLines(trace, traceLines);
+    int nbDiffs = 0;
+
+    for (size_t i = 0; i < goldenLines.size() || i < traceLines.size(); i++)
+    {
+        const std::string& g = i < goldenLines.size() ? goldenLines[i] : std::string("<end>");
+        const std::string& t = i < traceLines.size() ? traceLines[i] : std::string("<end>");
+
+        if (g != t)
+        {
+            if (nbDiffs < 10) {
+                fprintf(stderr, "line %lu:\n  golden: %s\n  trace:  %s\n", (unsigned long) i + 1, g.c_str(), t.c_str());
+            }
+
+            nbDiffs++;
+        }
+    }
+
+    return nbDiffs;
+}
+
+/** Decodes the whole sample file into the trace or the audio hashes. Returns false if the file cannot be read */
+static bool decodeFile(const std::string& samplePath, const GoldenMode& mode, bool blocks,
+        DSDcc::DSDFilters::DSDFilterArithmetic filterArithmetic, bool audio, bool async, std::string& text)
+{
+    FILE *fp = fopen(samplePath.c_str(), "rb");
+
+    if (!fp) {
+        return false;
+    }
+
+    DSDcc::DSDDecoder *dsdDecoder = new DSDcc::DSDDecoder(filterArithmetic);
+    dsdDecoder->setQuiet();
+    dsdDecoder->setLogVerbosity(0);
+    dsdDecoder->enableMbelib(audio);
+    dsdDecoder->enableMbeAsync(async);
+    dsdDecoder->setDecodeMode(DSDcc::DSDDecoder::DSDDecodeNone, true);
+    dsdDecoder->setDecodeMode(mode.m_mode, true);
+    dsdDecoder->setDataRate(mode.m_rate);
+
+    GoldenTrace trace(*dsdDecoder);
+    AudioHash audioHashes[2];
+    short samples[GOLDEN_PERIOD_SAMPLES];
+    size_t nbRead;
+    unsigned long nbSamples = 0;
+
+    while ((nbRead = fread(samples, sizeof(short), GOLDEN_PERIOD_SAMPLES, fp)) > 0)
+    {
+        if (blocks)
+        {
+            dsdDecoder->runBlock(samples, nbRead);
+        }
+        else
+        {
+            for (size_t i = 0; i < nbRead; i++) {
+                dsdDecoder->run(samples[i]);
+            }
+        }
+
+        nbSamples += nbRead;
+
+        if (audio) {
+            collectAudio(*dsdDecoder, audioHashes);
+        } else {
+            trace.update(nbSamples);
+        }
+    }
+
+    fclose(fp);
+
+    if (audio)
+    {
+        std::ostringstream os;
+
+        for (int slot = 0; slot < 2; slot++) {
+            os << "audio" << slot << " " << audioHashes[slot].m_nbSamples << " " << std::hex << audioHashes[slot].m_hash << std::dec << "\n";
+        }
+
+        text = os.str();
+    }
+    else
+    {
+        text = trace.getText();
+    }
+
+    delete dsdDecoder;
+    return true;
+}
+
+/** Compares text to the golden file or updates it. Returns the exit code */
+static int check(const std::string& goldenPath, const std::string& text, bool updateGolden, bool audio)
+{
+    if (updateGolden)
+    {
+        if (!writeFile(goldenPath, text))
+        {
+            fprintf(stderr, "%s: cannot write golden file\n", goldenPath.c_str());
+            return 1;
+        }
+
+        fprintf(stderr, "%s: updated\n", goldenPath.c_str());
+        return 0;
+    }
+
+    std::string golden;
+
+    if (!readFile(goldenPath, golden))
+    {
+        if (audio)
+        {
+            fprintf(stderr, "%s: audio golden file missing, skipped. Create it with -a -u on a system with mbelib\n", goldenPath.c_str());
+            return GOLDEN_SKIP;
+        }
+
+        fprintf(stderr, "%s: golden file missing. Create it with -u\n", goldenPath.c_str());
+        return 1;
+    }
+
+    int nbDiffs = compare(golden, text);
+
+    if (nbDiffs == 0)
+    {
+        fprintf(stderr, "%s: OK\n", goldenPath.c_str());
+        return 0;
+    }
+
+    fprintf(stderr, "%s: *KO* %d lines differ\n", goldenPath.c_str(), nbDiffs);
+    return 1;
+}
+
+static void usage()
+{
+    fprintf(stderr, "Usage: golden [-u] [-b] [-i] [-a] [-A] [-o trace file] <samples directory> <golden directory> <sample name>\n");
+}
+
+int main(int argc, char *argv[])
+{
+    bool updateGolden = false;
+    bool blocks = false;
+    DSDcc::DSDFilters::DSDFilterArithmetic filterArithmetic = DSDcc::DSDFilters::DSDFilterFloat;
+    bool audio = false;
+    bool async = false;
+    const char *traceFile = 0;
+    int c;
+
+    while ((c = getopt(argc, argv, "ubiaAo:")) != -1)
+    {
+        switch (c)
+        {
+        case 'u':
+            updateGolden = true;
+            break;
+        case 'b':
+            blocks = true;
+            break;
+        case 'i':
+            filterArithmetic = DSDcc::DSDFilters::DSDFilterFixedPoint;
+            break;
+        case 'a':
+            audio = true;
+            break;
+        case 'A':
+            audio = true;
+            async = true;
+            break;
+        case 'o':
+            traceFile = optarg;
+            break;
+        default:
+            usage();
+            return 1;
+        }
+    }
+
+    if (argc - optind != 3)
+    {
+        usage();
+        return 1;
+    }
+
+    std::string name(argv[optind + 2]);
+    std::string samplePath = std::string(argv[optind]) + "/" + name + ".dis";
+    std::string goldenPath = std::string(argv[optind + 1]) + "/" + name
+            + (filterArithmetic == DSDcc::DSDFilters::DSDFilterFixedPoint ? ".fixed" : "")
+            + (audio ? ".audio.golden" : ".golden");
+    const GoldenMode *mode = 0;
+
+    for (unsigned int i = 0; i < sizeof(goldenModes) / sizeof(GoldenMode); i++)
+    {
+        if (name.compare(0, strlen(goldenModes[i].m_prefix), goldenModes[i].m_prefix) == 0)
+        {
+            mode = &goldenModes[i];
+            break;
+        }
+    }
+
+    if (!mode)
+    {
+        fprintf(stderr, "%s: no decoding mode for this sample name\n", name.c_str());
+        return 1;
+    }
+
+#ifndef DSD_USE_MBELIB
+    if (audio)
+    {
+        fprintf(stderr, "%s: mbelib not compiled in, audio check skipped\n", name.c_str());
+        return GOLDEN_SKIP;
+    }
+#endif
+
+    std::string text;
+
+    if (!decodeFile(samplePath, *mode, blocks, filterArithmetic, audio, async, text))
+    {
+        fprintf(stderr, "%s: sample file missing\n", samplePath.c_str());
+        return 1;
+    }
+
+    if (traceFile && !writeFile(traceFile, text))
+    {
+        fprintf(stderr, "%s: cannot write trace\n", traceFile);
+        return 1;
+    }
+
+    return check(goldenPath, text, updateGolden, audio);
+}
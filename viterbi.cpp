@@ -15,10 +15,12 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
-#include <string.h>
-#include <limits.h>
 #include "viterbi.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
 namespace DSDcc
 {
 
@@ -115,16 +117,11 @@ Viterbi::Viterbi(int k, int n, const unsigned int *polys, bool msbFirst) :
         m_k(k),
         m_n(n),
         m_polys(polys),
-        m_nbSymbolsMax(0),
-        m_nbBitsMax(0),
 		m_msbFirst(msbFirst)
 {
     m_branchCodes = new unsigned char[(1<<m_k)];
     m_predA = new unsigned char[1<<(m_k-1)];
     m_predB = new unsigned char[1<<(m_k-1)];
-    m_pathMetrics = 0;
-    m_traceback = 0;
-    m_symbols = 0;
 
     initCodes();
     initTreillis();
@@ -132,18 +129,6 @@ Viterbi::Viterbi(int k, int n, const unsigned int *polys, bool msbFirst) :
 
 Viterbi::~Viterbi()
 {
-    if (m_symbols) {
-        delete[] m_symbols;
-    }
-
-    if (m_pathMetrics) {
-        delete[] m_pathMetrics;
-    }
-
-    if (m_traceback) {
-        delete[] m_traceback;
-    }
-
     delete[] m_predB;
     delete[] m_predA;
 	delete[] m_branchCodes;
@@ -219,179 +204,87 @@ void Viterbi::encodeToBits(
     }
 }
 
-void Viterbi::decodeFromBits(
-        unsigned char *dataBits,      //!< Decoded output data bits
-        const unsigned char *bits,    //!< Input bits
-        unsigned int nbBits,          //!< Number of imput bits
-        unsigned int startstate)      //!< Encoder starting state
-
+ViterbiK<5, 2>::ACS ViterbiACS16::select(const char*& kernelName)
 {
-    if (nbBits > m_nbBitsMax)
-    {
-        if (m_symbols) {
-            delete[] m_symbols;
-        }
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
 
-        m_symbols = new unsigned char[nbBits/m_n];
-        m_nbBitsMax = nbBits;
+    if (__builtin_cpu_supports("avx2")) // the 4 code metrics fit in one permutation
+    {
+        kernelName = "avx2";
+        return &acsAVX2;
     }
 
-    for (int i = 0; i < nbBits; i += m_n)
+    if (__builtin_cpu_supports("sse2"))
     {
-        m_symbols[i/m_n] = bits[i];
-
-        for (int j = m_n-1; j > 0; j--)
-        {
-            m_symbols[i/m_n] += bits[i+j] << j;
-        }
+        kernelName = "sse2";
+        return &acsSSE2;
     }
-
-    decodeFromSymbols(dataBits, m_symbols, nbBits/m_n, startstate);
+#endif
+    return 0;
 }
 
-void Viterbi::decodeFromSymbols(
-        unsigned char *dataBits,      //!< Decoded output data bits
-        const unsigned char *symbols, //!< Input symbols
-        unsigned int nbSymbols,       //!< Number of imput symbols
-        unsigned int startstate)      //!< Encoder starting state
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
 
+__attribute__((target("sse2")))
+uint32_t ViterbiACS16::acsSSE2(const uint32_t *codeMetrics, const int32_t (*acsBranchCodes)[8], uint32_t *pathMetrics)
 {
-    if (nbSymbols > m_nbSymbolsMax)
+    const __m128i bias = _mm_set1_epi32(0x80000000); // unsigned comparison with signed instructions
+    __m128 p0 = _mm_loadu_ps((const float *) &pathMetrics[0]);
+    __m128 p1 = _mm_loadu_ps((const float *) &pathMetrics[4]);
+    __m128 p2 = _mm_loadu_ps((const float *) &pathMetrics[8]);
+    __m128 p3 = _mm_loadu_ps((const float *) &pathMetrics[12]);
+    __m128i even[2], odd[2];
+    int survivors = 0;
+
+    even[0] = _mm_castps_si128(_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0))); // S0 S2 S4 S6
+    odd[0]  = _mm_castps_si128(_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1))); // S1 S3 S5 S7
+    even[1] = _mm_castps_si128(_mm_shuffle_ps(p2, p3, _MM_SHUFFLE(2, 0, 2, 0))); // S8 S10 S12 S14
+    odd[1]  = _mm_castps_si128(_mm_shuffle_ps(p2, p3, _MM_SHUFFLE(3, 1, 3, 1))); // S9 S11 S13 S15
+
+    for (int bit = 0; bit < 2; bit++)
     {
-        if (m_traceback) {
-            delete[] m_traceback;
-        }
-
-        if (m_pathMetrics) {
-            delete[] m_pathMetrics;
+        for (int h = 0; h < 2; h++)
+        {
+            const int32_t *upper = &acsBranchCodes[2*bit][4*h];
+            const int32_t *lower = &acsBranchCodes[2*bit + 1][4*h];
+            __m128i m1 = _mm_add_epi32(even[h], _mm_set_epi32(codeMetrics[upper[3]], codeMetrics[upper[2]], codeMetrics[upper[1]], codeMetrics[upper[0]]));
+            __m128i m2 = _mm_add_epi32(odd[h], _mm_set_epi32(codeMetrics[lower[3]], codeMetrics[lower[2]], codeMetrics[lower[1]], codeMetrics[lower[0]]));
+            __m128i upperSelected = _mm_cmplt_epi32(_mm_xor_si128(m1, bias), _mm_xor_si128(m2, bias)); // m1 < m2
+            __m128i m = _mm_or_si128(_mm_and_si128(upperSelected, m1), _mm_andnot_si128(upperSelected, m2));
+            _mm_storeu_si128((__m128i *) &pathMetrics[8*bit + 4*h], m);
+            survivors |= (~_mm_movemask_ps(_mm_castsi128_ps(upperSelected)) & 0xf) << (8*bit + 4*h);
         }
-
-        m_traceback = new unsigned char[(1<<(m_k-1)) * nbSymbols];
-        m_pathMetrics = new uint32_t[(1<<(m_k-1))*2]; // only one step back in memory
-        m_nbSymbolsMax = nbSymbols;
     }
 
-    // initial path metrics state
-    memset(m_pathMetrics, m_maxMetric, sizeof(uint32_t) * (1<<(m_k-1)));
-    m_pathMetrics[startstate] = 0;
-
-    unsigned int minPathIndex;
-    unsigned int minMetric;
+    return survivors;
+}
 
-    for (int is = 0; is < nbSymbols; is++)
-    {
-        minMetric = m_maxMetric;
-//        std::cerr << "S[" << is << "]=" << (int) symbols[is] << std::endl;
-
-        // compute branch metrics
-    	for (unsigned int ib = 0; ib < 1<<(m_k-1); ib++)
-    	{
-            unsigned char bit = ib < 1<<(m_k-2) ? 0 : 1;
-
-            // path A
-
-    	    unsigned char predA = m_predA[ib];
-    	    unsigned int predPMIxA = (is%2)*(1<<(m_k-1)) + predA;
-    	    unsigned char codeA = m_branchCodes[(predA<<1)+bit];
-    	    unsigned char bmA = NbOnes[codeA ^ symbols[is]]; // branch metric
-    	    unsigned int pmA = m_pathMetrics[predPMIxA] + bmA; // add branch metric to path metric
-
-            // path B
-
-    	    unsigned char predB = m_predB[ib];
-            unsigned int predPMIxB = (is%2)*(1<<(m_k-1)) + predB;
-            unsigned char codeB = m_branchCodes[(predB<<1)+bit];
-            unsigned char bmB = NbOnes[codeB ^ symbols[is]]; // branch metric
-            unsigned int pmB = m_pathMetrics[predPMIxB] + bmB; // add branch metric to path metric
-
-            // decisions, decisions ...
-
-//            std::cerr << "  Branch:"
-//                    << " " << ib
-//                    << " bit: " << (int) bit
-//                    << " predA: " << (int) predA
-//                    << " pm[" << (int) predA << ":" << is*(1<<(m_k-1)) << "]: " << m_pathMetrics[predPMIxA]
-//                    << " codeA: " << (int) codeA
-//                    << " bmA: " << (int) bmA
-//                    << " pmA: " << pmA
-//                    << " | predB: " << (int) predB
-//                    << " pm[" << (int) predB << ":" << is*(1<<(m_k-1)) << "]: " << m_pathMetrics[predPMIxB]
-//                    << " codeB: " << (int) codeB
-//                    << " bmB: " << (int) bmB
-//                    << " pmB: " << pmB << std::endl;
-
-            bool a_b; // true: A, false: B
-
-            if (pmA == pmB) // path metrics are even
-            {
-                if (bmA == bmB)
-                {
-                    a_b = true; // arbitrary
-                }
-                else
-                {
-                    a_b = bmA < bmB;
-                }
-            }
-            else
-            {
-                a_b = pmA < pmB;
-            }
-
-            if (a_b) // A selected
-            {
-                m_pathMetrics[ib + ((is+1)%2)*(1<<(m_k-1))] = pmA;
-                m_traceback[ib + is*(1<<(m_k-1))] = predA; // Pack predecessor branch # and bit value
-
-                if (pmA < minMetric)
-                {
-                    minMetric = pmA;
-                    minPathIndex = ib;
-                }
-
-//                std::cerr << "    Select A:"
-//                        << " pm: " << pmA
-//                        << " bit: " << (int) bit
-//                        << " m_traceback[" << ib + is*(1<<(m_k-1)) << "]: " << (int) predA
-//                        << std::endl;
-            }
-            else
-            {
-                m_pathMetrics[ib + ((is+1)%2)*(1<<(m_k-1))] = pmB;
-                m_traceback[ib + is*(1<<(m_k-1))] = predB; // Pack predecessor branch # and bit value
-
-                if (pmB < minMetric)
-                {
-                    minMetric = pmB;
-                    minPathIndex = ib;
-                }
-
-//                std::cerr << "    Select B:"
-//                        << " pm: " << pmB
-//                        << " bit: " << (int) bit
-//                        << " m_traceback[" << ib + is*(1<<(m_k-1)) << "]: " << (int) predB
-//                        << std::endl;
-
-            } // path decision
-    	} // branches
-    } // symbols
-
-    // trace back
-
-    unsigned int bIx = minPathIndex;
-
-    for (int is = nbSymbols-1; is >= 0; is--)
+__attribute__((target("avx2")))
+uint32_t ViterbiACS16::acsAVX2(const uint32_t *codeMetrics, const int32_t (*acsBranchCodes)[8], uint32_t *pathMetrics)
+{
+    const __m256i bias = _mm256_set1_epi32(0x80000000); // unsigned comparison with signed instructions
+    const __m256i deinterleave = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    __m256i cm = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) codeMetrics)); // only lanes 0..3 are indexed
+    __m256i a = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *) &pathMetrics[0]), deinterleave); // S0 S2 S4 S6 S1 S3 S5 S7
+    __m256i b = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *) &pathMetrics[8]), deinterleave); // S8 S10 S12 S14 S9 S11 S13 S15
+    __m256i even = _mm256_permute2x128_si256(a, b, 0x20);
+    __m256i odd  = _mm256_permute2x128_si256(a, b, 0x31);
+    int survivors = 0;
+
+    for (int bit = 0; bit < 2; bit++)
     {
-//    	std::cerr << "is: " << is
-//    			<< " bIx: " << (int) bIx
-//    			<< " bit: " << bIx < 1<<(m_k-2) ? 0 : 1;
-//				<< " pred: " << (int) m_traceback[bIx + is*(1<<(m_k-1))]
-//				<< std::endl;
-        dataBits[is] = bIx < 1<<(m_k-2) ? 0 : 1;
-        bIx = m_traceback[bIx + is*(1<<(m_k-1))];
+        __m256i m1 = _mm256_add_epi32(even, _mm256_permutevar8x32_epi32(cm, _mm256_loadu_si256((const __m256i *) acsBranchCodes[2*bit])));
+        __m256i m2 = _mm256_add_epi32(odd, _mm256_permutevar8x32_epi32(cm, _mm256_loadu_si256((const __m256i *) acsBranchCodes[2*bit + 1])));
+        __m256i upperSelected = _mm256_cmpgt_epi32(_mm256_xor_si256(m2, bias), _mm256_xor_si256(m1, bias)); // m1 < m2
+        _mm256_storeu_si256((__m256i *) &pathMetrics[8*bit], _mm256_blendv_epi8(m2, m1, upperSelected));
+        survivors |= (~_mm256_movemask_ps(_mm256_castsi256_ps(upperSelected)) & 0xff) << (8*bit);
     }
+
+    return survivors;
 }
 
+#endif
 
 } // namespace DSDcc
 
@@ -20,14 +20,18 @@
 #define VITERBI_H_
 
 #include <stdint.h>
+#include <assert.h>
 
 namespace DSDcc
 {
 
+/**
+ * Convolutional encoder and interface of the Viterbi decoders. The decoders themselves are instances
+ * of the ViterbiK template below for a given constraint length K and rate 1/N.
+ */
 class Viterbi
 {
 public:
-    Viterbi(int k, int n, const unsigned int *polys, bool msbFirst = true);
     virtual ~Viterbi();
 
     /** Convolutionally encode data into binary symbols */
@@ -52,7 +56,7 @@ public:
         const unsigned char *symbols,     //!< Input symbols
         unsigned int nbSymbols,     //!< Number of imput symbols
         unsigned int startstate     //!< Encoder starting state
-    );
+    ) = 0;
 
     /* Viterbi decoder */
     virtual void decodeFromBits(
@@ -60,7 +64,16 @@ public:
         const unsigned char *bits,  //!< Input bits
         unsigned int nbBits,        //!< Number of imput bits
         unsigned int startstate     //!< Encoder starting state
-    );
+    ) = 0;
+
+    /** Viterbi decoder with soft decision inputs. Branch metrics are distances to the soft values instead of Hamming distances */
+    virtual void decodeFromSoftBits(
+        unsigned char *dataBits,       //!< Decoded output data bits
+        const unsigned char *softBits, //!< Input soft bits from 0 (certain 0) to softMax (certain 1) in the same order as bits in decodeFromBits
+        unsigned int nbBits,           //!< Number of input soft bits
+        unsigned int startstate,       //!< Encoder starting state
+        unsigned char softMax = 15     //!< Soft value of a certain 1: 7 for 3 bit or 15 for 4 bit quantization
+    ) = 0;
 
     int getK() const { return m_k; }
     int getN() const { return m_n; }
@@ -78,6 +91,8 @@ public:
     static const unsigned char NbOnes[];
 
 protected:
+    Viterbi(int k, int n, const unsigned int *polys, bool msbFirst);
+
     void initCodes();
     void initTreillis();
 
@@ -92,17 +107,331 @@ protected:
     int m_n;
     const unsigned int *m_polys;
     bool m_msbFirst;
-    uint32_t *m_pathMetrics;
-    unsigned char *m_traceback;
     unsigned char *m_branchCodes;
     unsigned char *m_predA;
     unsigned char *m_predB;
-    unsigned char *m_symbols;
-    int m_nbSymbolsMax;
-    int m_nbBitsMax;
     static const uint32_t m_maxMetric;
 };
 
+/** Branch metrics: Hamming distance of each code to hard decision symbols */
+template<int N>
+struct ViterbiSymbolMetric
+{
+    ViterbiSymbolMetric(const unsigned char *symbols) : m_symbols(symbols) {}
+
+    void operator()(uint32_t *codeMetrics, unsigned int is) const
+    {
+        for (int code = 0; code < (1<<N); code++) {
+            codeMetrics[code] = Viterbi::NbOnes[code ^ m_symbols[is]];
+        }
+    }
+
+    const unsigned char *m_symbols;
+};
+
+/** Branch metrics: Hamming distance of each code to hard decision bits. Bit j of the code is the j-th bit of the symbol */
+template<int N>
+struct ViterbiBitMetric
+{
+    ViterbiBitMetric(const unsigned char *bits) : m_bits(bits) {}
+
+    void operator()(uint32_t *codeMetrics, unsigned int is) const
+    {
+        const unsigned char *bits = &m_bits[is*N];
+        unsigned int symbol = 0;
+
+        for (int j = 0; j < N; j++) {
+            symbol += bits[j] << j;
+        }
+
+        for (int code = 0; code < (1<<N); code++) {
+            codeMetrics[code] = Viterbi::NbOnes[code ^ symbol];
+        }
+    }
+
+    const unsigned char *m_bits;
+};
+
+/** Branch metrics: distance of each code to soft bits from 0 (certain 0) to softMax (certain 1) */
+template<int N>
+struct ViterbiSoftBitMetric
+{
+    ViterbiSoftBitMetric(const unsigned char *softBits, unsigned char softMax) : m_softBits(softBits), m_softMax(softMax) {}
+
+    void operator()(uint32_t *codeMetrics, unsigned int is) const
+    {
+        const unsigned char *softBits = &m_softBits[is*N];
+        codeMetrics[0] = 0;
+
+        for (int j = 0; j < N; j++) // bit j of the code is softBits[j] as in decodeFromBits
+        {
+            for (int code = 0; code < (1<<j); code++) // extend the codes of bits 0..j-1 with bit j
+            {
+                codeMetrics[code | (1<<j)] = codeMetrics[code] + (m_softMax - softBits[j]);
+                codeMetrics[code] += softBits[j];
+            }
+        }
+    }
+
+    const unsigned char *m_softBits;
+    unsigned char m_softMax;
+};
+
+/**
+ * Viterbi decoder for constraint length K (2 to 6) and rate 1/N. The trellis is fixed at compile time:
+ * new state S(j + b*2^(K-2)) with b the decoded bit comes from S2j (upper path) or S2j+1 (lower path).
+ * The survivors of one symbol are packed in one word with one bit per state set when the lower path
+ * is selected. Branch metrics are computed symbol by symbol by a metric functor so that other metrics
+ * can be plugged in with decode().
+ */
+template<int K, int N>
+class ViterbiK : public Viterbi
+{
+public:
+    static const int NbStates = 1<<(K-1);
+    static const int NbCodes = 1<<N;
+
+    ViterbiK(const unsigned int *polys, bool msbFirst = true, unsigned int maxSymbols = 0);
+    virtual ~ViterbiK();
+
+    /**
+     * Preallocate the path memory for frames of up to nbSymbols symbols. Decoding then never allocates
+     * and a longer frame fails an assertion (it still grows the path memory when built with NDEBUG).
+     */
+    void reserve(unsigned int nbSymbols);
+
+    virtual void decodeFromSymbols(
+        unsigned char *dataBits,
+        const unsigned char *symbols,
+        unsigned int nbSymbols,
+        unsigned int startstate)
+    {
+        decode(dataBits, ViterbiSymbolMetric<N>(symbols), nbSymbols, startstate);
+    }
+
+    virtual void decodeFromBits(
+        unsigned char *dataBits,
+        const unsigned char *bits,
+        unsigned int nbBits,
+        unsigned int startstate)
+    {
+        decode(dataBits, ViterbiBitMetric<N>(bits), nbBits/N, startstate);
+    }
+
+    virtual void decodeFromSoftBits(
+        unsigned char *dataBits,
+        const unsigned char *softBits,
+        unsigned int nbBits,
+        unsigned int startstate,
+        unsigned char softMax = 15)
+    {
+        decode(dataBits, ViterbiSoftBitMetric<N>(softBits, softMax), nbBits/N, startstate);
+    }
+
+    /** Decode with the branch metrics given by metric(codeMetrics, symbolIndex) filling the 2^N code metrics of a symbol */
+    template<typename Metric>
+    void decode(
+        unsigned char *dataBits,    //!< Decoded output data bits
+        const Metric& metric,       //!< Branch metrics functor
+        unsigned int nbSymbols,     //!< Number of imput symbols
+        unsigned int startstate     //!< Encoder starting state
+    );
+
+    const char *getKernelName() const { return m_kernelName; } //!< add-compare-select kernel selected at run time
+
+    /** Add-compare-select of all states for one symbol. Returns the packed survivors */
+    typedef uint32_t (*ACS)(const uint32_t *codeMetrics, const int32_t (*acsBranchCodes)[NbStates/2], uint32_t *pathMetrics);
+
+private:
+    typedef char CheckK[(K >= 2) && (K <= 6) ? 1 : -1]; //!< survivors must fit in 32 bits
+
+    static ACS selectACS(const char*& kernelName);
+    static uint32_t acsScalar(const uint32_t *codeMetrics, const int32_t (*acsBranchCodes)[NbStates/2], uint32_t *pathMetrics);
+
+    int32_t m_acsBranchCodes[4][NbStates/2]; //!< codes of the upper and lower paths into the first half of the states (bit 0) then into the second half (bit 1)
+    uint32_t m_pathMetrics[NbStates];
+    uint32_t *m_survivors;                   //!< packed survivors one word per symbol
+    unsigned int m_nbSymbolsMax;
+    bool m_fixedCapacity;                    //!< path memory size was set by reserve()
+    ACS m_acs;
+    const char *m_kernelName;
+};
+
+/** SSE2 and AVX2 add-compare-select kernels for 16 states and 4 codes (K=5 N=2) */
+struct ViterbiACS16
+{
+    static ViterbiK<5, 2>::ACS select(const char*& kernelName); //!< null if the CPU has none of them
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    static uint32_t acsSSE2(const uint32_t *codeMetrics, const int32_t (*acsBranchCodes)[8], uint32_t *pathMetrics);
+    static uint32_t acsAVX2(const uint32_t *codeMetrics, const int32_t (*acsBranchCodes)[8], uint32_t *pathMetrics);
+#endif
+};
+
+template<int K, int N>
+ViterbiK<K, N>::ViterbiK(const unsigned int *polys, bool msbFirst, unsigned int maxSymbols) :
+        Viterbi(K, N, polys, msbFirst),
+        m_survivors(0),
+        m_nbSymbolsMax(0),
+        m_fixedCapacity(false)
+{
+    for (int j = 0; j < NbStates/2; j++)
+    {
+        m_acsBranchCodes[0][j] = m_branchCodes[4*j];     // S2j   -> Sj
+        m_acsBranchCodes[1][j] = m_branchCodes[4*j + 2]; // S2j+1 -> Sj
+        m_acsBranchCodes[2][j] = m_branchCodes[4*j + 1]; // S2j   -> Sj+2^(K-2)
+        m_acsBranchCodes[3][j] = m_branchCodes[4*j + 3]; // S2j+1 -> Sj+2^(K-2)
+    }
+
+    m_acs = selectACS(m_kernelName);
+
+    if (maxSymbols > 0) {
+        reserve(maxSymbols);
+    }
+}
+
+template<int K, int N>
+ViterbiK<K, N>::~ViterbiK()
+{
+    if (m_survivors) {
+        delete[] m_survivors;
+    }
+}
+
+template<int K, int N>
+void ViterbiK<K, N>::reserve(unsigned int nbSymbols)
+{
+    if (nbSymbols > m_nbSymbolsMax)
+    {
+        if (m_survivors) {
+            delete[] m_survivors;
+        }
+
+        m_survivors = new uint32_t[nbSymbols];
+        m_nbSymbolsMax = nbSymbols;
+    }
+
+    m_fixedCapacity = true;
+}
+
+template<int K, int N>
+template<typename Metric>
+void ViterbiK<K, N>::decode(
+        unsigned char *dataBits,
+        const Metric& metric,
+        unsigned int nbSymbols,
+        unsigned int startstate)
+{
+    if (nbSymbols > m_nbSymbolsMax)
+    {
+        assert(!m_fixedCapacity); // frame longer than the reserved path memory
+
+        if (m_survivors) {
+            delete[] m_survivors;
+        }
+
+        m_survivors = new uint32_t[nbSymbols];
+        m_nbSymbolsMax = nbSymbols;
+    }
+
+    // initial path metrics state: only the encoder starting state is reachable
+    for (int s = 0; s < NbStates; s++) {
+        m_pathMetrics[s] = m_maxMetric;
+    }
+
+    m_pathMetrics[startstate] = 0;
+
+    uint32_t codeMetrics[NbCodes];
+
+    if (m_acs == &acsScalar) // let the compiler inline the generic kernel
+    {
+        for (unsigned int is = 0; is < nbSymbols; is++)
+        {
+            metric(codeMetrics, is);
+            m_survivors[is] = acsScalar(codeMetrics, m_acsBranchCodes, m_pathMetrics);
+        }
+    }
+    else
+    {
+        for (unsigned int is = 0; is < nbSymbols; is++)
+        {
+            metric(codeMetrics, is);
+            m_survivors[is] = m_acs(codeMetrics, m_acsBranchCodes, m_pathMetrics);
+        }
+    }
+
+    // trace back from the best final state
+
+    uint32_t minPathMetric = m_pathMetrics[0];
+    unsigned int state = 0;
+
+    for (int s = 1; s < NbStates; s++)
+    {
+        if (m_pathMetrics[s] < minPathMetric)
+        {
+            minPathMetric = m_pathMetrics[s];
+            state = s;
+        }
+    }
+
+    for (int is = nbSymbols - 1; is >= 0; is--)
+    {
+        dataBits[is] = state >> (K-2); // second half of the states is reached with a 1
+        state = 2*(state & (NbStates/2 - 1)) + ((m_survivors[is] >> state) & 1);
+    }
+}
+
+template<int K, int N>
+typename ViterbiK<K, N>::ACS ViterbiK<K, N>::selectACS(const char*& kernelName)
+{
+    kernelName = "scalar";
+    return &acsScalar;
+}
+
+template<>
+inline ViterbiK<5, 2>::ACS ViterbiK<5, 2>::selectACS(const char*& kernelName)
+{
+    ACS acs = ViterbiACS16::select(kernelName);
+
+    if (acs) {
+        return acs;
+    }
+
+    kernelName = "scalar";
+    return &acsScalar;
+}
+
+template<int K, int N>
+uint32_t ViterbiK<K, N>::acsScalar(const uint32_t *codeMetrics, const int32_t (*acsBranchCodes)[NbStates/2], uint32_t *pathMetrics)
+{
+    uint32_t tempMetric[NbStates];
+    uint32_t survivors = 0;
+
+    for (int bit = 0; bit < 2; bit++)
+    {
+        for (int j = 0; j < NbStates/2; j++)
+        {
+            uint32_t m1 = codeMetrics[acsBranchCodes[2*bit][j]]     + pathMetrics[2*j];     // upper path
+            uint32_t m2 = codeMetrics[acsBranchCodes[2*bit + 1][j]] + pathMetrics[2*j + 1]; // lower path
+
+            if (m1 < m2)
+            {
+                tempMetric[(NbStates/2)*bit + j] = m1;
+            }
+            else
+            {
+                tempMetric[(NbStates/2)*bit + j] = m2;
+                survivors |= 1U << ((NbStates/2)*bit + j);
+            }
+        }
+    }
+
+    for (int s = 0; s < NbStates; s++) {
+        pathMetrics[s] = tempMetric[s];
+    }
+
+    return survivors;
+}
+
 } // namespace DSDcc
 
 #endif /* VITERBI_H_ */
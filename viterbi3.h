@@ -1,7 +1,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 // Copyright (C) 2016 Edouard Griffiths, F4EXB.                                  //
 //                                                                               //
-// Class specialized for K=3 decoding                                            //
+// K=3 rate 1/2 decoder (D-Star)                                                 //
 //                                                                               //
 // This program is free software; you can redistribute it and/or modify          //
 // it under the terms of the GNU General Public License as published by          //
@@ -24,50 +24,7 @@
 namespace DSDcc
 {
 
-class Viterbi3 : public Viterbi
-{
-public:
-    Viterbi3(int n, const unsigned int *polys, bool msbFirst = true);
-    virtual ~Viterbi3();
-
-    /* Viterbi decoder */
-    virtual void decodeFromSymbols(
-            unsigned char *dataBits,      //!< Decoded output data bits
-            const unsigned char *symbols, //!< Input symbols
-            unsigned int nbSymbols,       //!< Number of imput symbols
-            unsigned int startstate       //!< Encoder starting state
-    );
-
-    /* Viterbi decoder */
-    virtual void decodeFromBits(
-        unsigned char *dataBits,    //!< Decoded output data bits
-        const unsigned char *bits,  //!< Input bits
-        unsigned int nbBits,        //!< Number of imput bits
-        unsigned int startstate     //!< Encoder starting state
-    );
-
-private:
-    static void doMetrics (
-            int n,
-            unsigned char *branchCodes,
-            unsigned char symbol,
-            unsigned char *m_pathMemory0,
-            unsigned char *m_pathMemory1,
-            unsigned char *m_pathMemory2,
-            unsigned char *m_pathMemory3,
-            uint32_t *m_pathMetric
-    );
-
-    static void traceBack (
-            int nbSymbols,
-            unsigned int startState,
-            unsigned char *out,
-            unsigned char *m_pathMemory0,
-            unsigned char *m_pathMemory1,
-            unsigned char *m_pathMemory2,
-            unsigned char *m_pathMemory3
-    );
-};
+typedef ViterbiK<3, 2> Viterbi3;
 
 } // namespace DSDcc
 
@@ -16,7 +16,6 @@
 
 #include "ysf.h"
 #include "dsd_decoder.h"
-#include "mbefec.h"
 
 namespace DSDcc
 {
@@ -189,7 +188,7 @@ const char * DSDYSF::ysfCallModeText[4] = {
 DSDYSF::DSDYSF(DSDDecoder *dsdDecoder) :
         m_dsdDecoder(dsdDecoder),
         m_symbolIndex(0),
-        m_viterbiFICH(2, Viterbi::Poly25y, true),
+        m_viterbiFICH(Viterbi::Poly25y, true, 180),
         m_crc(DSDcc::CRC::PolyCCITT16, 16, 0x0, 0xffff),
         m_pn(0x1c9),
 		m_fichError(FICHNoError)
@@ -227,7 +226,7 @@ void DSDYSF::process() // just pass the frames for now
 
     if (m_symbolIndex < 100)
     {
-        processFICH(m_symbolIndex, dibit);
+        processFICH(m_symbolIndex);
 
         if (m_symbolIndex == 100 -1)
         {
@@ -261,7 +260,7 @@ void DSDYSF::process() // just pass the frames for now
         {
         case FIHeader:
         case FITerminator:
-            processHeader(m_symbolIndex - 100, dibit);
+            processHeader(m_symbolIndex - 100);
             break;
         case FICommunication:
             {
@@ -298,20 +297,22 @@ void DSDYSF::process() // just pass the frames for now
     m_symbolIndex++;
 }
 
-void DSDYSF::processFICH(int symbolIndex, unsigned char dibit)
+void DSDYSF::processFICH(int symbolIndex)
 {
-    m_fichRaw[m_fichInterleave[symbolIndex]] = dibit;
+    storeSoftDibit(m_fichRaw, m_fichInterleave[symbolIndex]);
 
     if (symbolIndex == 100-1)
     {
-        m_viterbiFICH.decodeFromSymbols(m_fichGolay, m_fichRaw, 100, 0);
+        m_dsdDecoder->decodeViterbi(m_viterbiFICH, m_fichGolay, m_fichRaw, 200);
         int i = 0;
 
         for (; i < 4; i++)
         {
-            if (m_golay_24_12.decode(&m_fichGolay[24*i]))
+            uint32_t fichWord;
+
+            if (m_dsdDecoder->decodeFEC<Golay_24_12>(DSDDecoder::DSDFECGolay, FECBits::pack(&m_fichGolay[24*i], 24), fichWord) >= 0)
             {
-                memcpy(&m_fichBits[12*i], &m_fichGolay[24*i], 12);
+                FECBits::unpack(fichWord, &m_fichBits[12*i], 12);
             }
             else
             {
@@ -340,55 +341,55 @@ void DSDYSF::processFICH(int symbolIndex, unsigned char dibit)
     }
 }
 
-void DSDYSF::processHeader(int symbolIndex, unsigned char dibit)
+void DSDYSF::processHeader(int symbolIndex)
 {
     if (symbolIndex < 36)         // DCH1(0)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex]);
     }
     else if (symbolIndex < 2*36)  // DCH2(0)
     {
-        m_dch2Raw[m_dchInterleave[symbolIndex - 36]] = dibit;
+        storeSoftDibit(m_dch2Raw, m_dchInterleave[symbolIndex - 36]);
     }
     else if (symbolIndex < 3*36)  // DCH1(1)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex - 36]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex - 36]);
     }
     else if (symbolIndex < 4*36)  // DCH2(1)
     {
-        m_dch2Raw[m_dchInterleave[symbolIndex - 2*36]] = dibit;
+        storeSoftDibit(m_dch2Raw, m_dchInterleave[symbolIndex - 2*36]);
     }
     else if (symbolIndex < 5*36)  // DCH1(2)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex - 2*36]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex - 2*36]);
     }
     else if (symbolIndex < 6*36)  // DCH2(2)
     {
-        m_dch2Raw[m_dchInterleave[symbolIndex - 3*36]] = dibit;
+        storeSoftDibit(m_dch2Raw, m_dchInterleave[symbolIndex - 3*36]);
     }
     else if (symbolIndex < 7*36)  // DCH1(3)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex - 3*36]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex - 3*36]);
     }
     else if (symbolIndex < 8*36)  // DCH2(3)
     {
-        m_dch2Raw[m_dchInterleave[symbolIndex - 4*36]] = dibit;
+        storeSoftDibit(m_dch2Raw, m_dchInterleave[symbolIndex - 4*36]);
     }
     else if (symbolIndex < 9*36)  // DCH1(4)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex - 4*36]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex - 4*36]);
     }
     else if (symbolIndex < 10*36) // DCH2(4)
     {
-        m_dch2Raw[m_dchInterleave[symbolIndex - 5*36]] = dibit;
+        storeSoftDibit(m_dch2Raw, m_dchInterleave[symbolIndex - 5*36]);
     }
 
     if (symbolIndex == 360 - 1) // final
     {
         unsigned char bytes[22];
 
-        m_viterbiFICH.decodeFromSymbols(m_dch1Bits, m_dch1Raw, 180, 0);
-        m_viterbiFICH.decodeFromSymbols(m_dch2Bits, m_dch2Raw, 180, 0);
+        m_dsdDecoder->decodeViterbi(m_viterbiFICH, m_dch1Bits, m_dch1Raw, 360);
+        m_dsdDecoder->decodeViterbi(m_viterbiFICH, m_dch2Bits, m_dch2Raw, 360);
 
         if (checkCRC16(m_dch1Bits, 20, bytes)) // CSD1
         {
@@ -464,7 +465,7 @@ void DSDYSF::processVD1(int symbolIndex, unsigned char dibit)
 {
     if (symbolIndex < 36)         // DCH(0)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex]);
     }
     else if (symbolIndex < 2*36)  // VCH(0)
     {
@@ -472,7 +473,7 @@ void DSDYSF::processVD1(int symbolIndex, unsigned char dibit)
     }
     else if (symbolIndex < 3*36)  // DCH(1)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex - 36]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex - 36]);
     }
     else if (symbolIndex < 4*36)  // VCH(1)
     {
@@ -480,7 +481,7 @@ void DSDYSF::processVD1(int symbolIndex, unsigned char dibit)
     }
     else if (symbolIndex < 5*36)  // DCH(2)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex - 2*36]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex - 2*36]);
     }
     else if (symbolIndex < 6*36)  // VCH(2)
     {
@@ -488,7 +489,7 @@ void DSDYSF::processVD1(int symbolIndex, unsigned char dibit)
     }
     else if (symbolIndex < 7*36)  // DCH(3)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex - 3*36]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex - 3*36]);
     }
     else if (symbolIndex < 8*36)  // VCH(3)
     {
@@ -496,13 +497,13 @@ void DSDYSF::processVD1(int symbolIndex, unsigned char dibit)
     }
     else if (symbolIndex < 9*36)  // DCH(4)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex - 4*36]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex - 4*36]);
 
         if (symbolIndex == 9*36 - 1)
         {
             unsigned char bytes[22];
 
-            m_viterbiFICH.decodeFromSymbols(m_dch1Bits, m_dch1Raw, 180, 0);
+            m_dsdDecoder->decodeViterbi(m_viterbiFICH, m_dch1Bits, m_dch1Raw, 360);
 
             if (checkCRC16(m_dch1Bits, 20, bytes)) // CSD
             {
@@ -534,7 +535,7 @@ void DSDYSF::processVD2(int symbolIndex, unsigned char dibit)
 {
     if (symbolIndex < 20) // DCH(0) - reuse FICH buffer
     {
-        m_fichRaw[m_fichInterleave[symbolIndex]] = dibit;
+        storeSoftDibit(m_fichRaw, m_fichInterleave[symbolIndex]);
     }
     else if (symbolIndex < 20 + 52) // VCH(0) and VeCH(0)
     {
@@ -542,7 +543,7 @@ void DSDYSF::processVD2(int symbolIndex, unsigned char dibit)
     }
     else if (symbolIndex < 2*20 + 52) // DCH(1)
     {
-        m_fichRaw[m_fichInterleave[symbolIndex - 52]] = dibit;
+        storeSoftDibit(m_fichRaw, m_fichInterleave[symbolIndex - 52]);
     }
     else if (symbolIndex < 2*20 + 2*52) // VCH(1) and VeCH(1)
     {
@@ -550,7 +551,7 @@ void DSDYSF::processVD2(int symbolIndex, unsigned char dibit)
     }
     else if (symbolIndex < 3*20 + 2*52) // DCH(2)
     {
-        m_fichRaw[m_fichInterleave[symbolIndex - 2*52]] = dibit;
+        storeSoftDibit(m_fichRaw, m_fichInterleave[symbolIndex - 2*52]);
     }
     else if (symbolIndex < 3*20 + 3*52) // VCH(2) and VeCH(2)
     {
@@ -558,7 +559,7 @@ void DSDYSF::processVD2(int symbolIndex, unsigned char dibit)
     }
     else if (symbolIndex < 4*20 + 3*52) // DCH(3)
     {
-        m_fichRaw[m_fichInterleave[symbolIndex - 3*52]] = dibit;
+        storeSoftDibit(m_fichRaw, m_fichInterleave[symbolIndex - 3*52]);
     }
     else if (symbolIndex < 4*20 + 4*52) // VCH(3) and VeCH(3)
     {
@@ -566,13 +567,13 @@ void DSDYSF::processVD2(int symbolIndex, unsigned char dibit)
     }
     else if (symbolIndex < 5*20 + 4*52) // DCH(4)
     {
-        m_fichRaw[m_fichInterleave[symbolIndex - 4*52]] = dibit;
+        storeSoftDibit(m_fichRaw, m_fichInterleave[symbolIndex - 4*52]);
 
         if (symbolIndex == (5*20 + 4*52) - 1) // Final DCH
         {
             unsigned char bytes[12];
 
-            m_viterbiFICH.decodeFromSymbols(m_fichGolay, m_fichRaw, 100, 0); // reuse FICH
+            m_dsdDecoder->decodeViterbi(m_viterbiFICH, m_fichGolay, m_fichRaw, 200); // reuse FICH
 
             if (checkCRC16(m_fichGolay, 10, bytes))
             {
@@ -667,8 +668,8 @@ void DSDYSF::processVD2Voice(int mbeIndex, unsigned char dibit)
             }
         }
 
+        m_dsdDecoder->pushDVFrame(0); // Indicate that a DVSI frame is available
         m_dsdDecoder->m_mbeDecoder1.processData(0, (char *) m_vd2MBEBits);
-        m_dsdDecoder->m_mbeDVReady1 = true; // Indicate that a DVSI frame is available
     }
 }
 
@@ -688,7 +689,7 @@ void DSDYSF::processVFRSubHeader(int symbolIndex, unsigned char dibit)
 {
     if (symbolIndex < 5*36)
     {
-        m_dch1Raw[m_dchInterleave[symbolIndex]] = dibit;
+        storeSoftDibit(m_dch1Raw, m_dchInterleave[symbolIndex]);
 
         if (symbolIndex == 5*36 - 1)
         {
@@ -696,7 +697,7 @@ void DSDYSF::processVFRSubHeader(int symbolIndex, unsigned char dibit)
 
             unsigned char bytes[22];
 
-            m_viterbiFICH.decodeFromSymbols(m_dch1Bits, m_dch1Raw, 180, 0);
+            m_dsdDecoder->decodeViterbi(m_viterbiFICH, m_dch1Bits, m_dch1Raw, 360);
 
             if (checkCRC16(m_dch1Bits, 20, bytes)) // CSD3
             {
@@ -771,8 +772,8 @@ void DSDYSF::processAMBE(int mbeIndex, unsigned char dibit)
 
 	if (mbeIndex == 36-1) // finalize
 	{
+        m_dsdDecoder->pushDVFrame(0); // Indicate that a DVSI frame is available
         m_dsdDecoder->m_mbeDecoder1.processFrame(0, m_dsdDecoder->ambe_fr, 0);
-        m_dsdDecoder->m_mbeDVReady1 = true; // Indicate that a DVSI frame is available
 	}
 }
 
@@ -788,7 +789,7 @@ void DSDYSF::procesVFRFrame(int mbeIndex, unsigned char dibit)
 
 	if (mbeIndex == 72-1) // finalize
 	{
-	    int errs;
+	    int errs = 0; // bits corrected in the whole frame
         uint16_t seed = 0;
 
         for (uint16_t i = 0; i < 12; i++)
@@ -799,31 +800,31 @@ void DSDYSF::procesVFRFrame(int mbeIndex, unsigned char dibit)
         scrambleVFR(m_vfrBitsRaw+23, m_vfrBitsRaw+23, 144-23-7, seed, 4);
 
         // u0
-        errs = GolayMBE::mbe_golay2312(m_vfrBitsRaw, m_vfrBits);
+        errs += m_dsdDecoder->decodeAMBEGolay(m_vfrBitsRaw, m_vfrBits);
 //        memcpy(m_vfrBits, m_vfrBitsRaw, 12);
 
         // u1
-        errs = GolayMBE::mbe_golay2312(&m_vfrBitsRaw[23], &m_vfrBits[12]);
+        errs += m_dsdDecoder->decodeAMBEGolay(&m_vfrBitsRaw[23], &m_vfrBits[12]);
 //        memcpy(&m_vfrBits[12], &m_vfrBitsRaw[23], 12);
 
         // u2
-        errs = GolayMBE::mbe_golay2312(&m_vfrBitsRaw[46], &m_vfrBits[24]);
+        errs += m_dsdDecoder->decodeAMBEGolay(&m_vfrBitsRaw[46], &m_vfrBits[24]);
 //        memcpy(&m_vfrBits[24], &m_vfrBitsRaw[46], 12);
 
         // u3
-        errs = GolayMBE::mbe_golay2312(&m_vfrBitsRaw[69], &m_vfrBits[36]);
+        errs += m_dsdDecoder->decodeAMBEGolay(&m_vfrBitsRaw[69], &m_vfrBits[36]);
 //        memcpy(&m_vfrBits[36], &m_vfrBitsRaw[69], 12);
 
         // u4
-        errs = HammingMBE::mbe_hamming1511(&m_vfrBitsRaw[92], &m_vfrBits[48]);
+        errs += m_dsdDecoder->decodeAMBEHamming(&m_vfrBitsRaw[92], &m_vfrBits[48]);
 //        memcpy(&m_vfrBits[48], &m_vfrBitsRaw[92], 11);
 
         // u5
-        errs = HammingMBE::mbe_hamming1511(&m_vfrBitsRaw[107], &m_vfrBits[59]);
+        errs += m_dsdDecoder->decodeAMBEHamming(&m_vfrBitsRaw[107], &m_vfrBits[59]);
 //        memcpy(&m_vfrBits[59], &m_vfrBitsRaw[107], 11);
 
         // u6
-        errs = HammingMBE::mbe_hamming1511(&m_vfrBitsRaw[122], &m_vfrBits[70]);
+        errs += m_dsdDecoder->decodeAMBEHamming(&m_vfrBitsRaw[122], &m_vfrBits[70]);
 //        memcpy(&m_vfrBits[70], &m_vfrBitsRaw[122], 11);
 
         // u7
@@ -834,8 +835,8 @@ void DSDYSF::procesVFRFrame(int mbeIndex, unsigned char dibit)
             m_dsdDecoder->m_mbeDVFrame1[i/8] += m_vfrBits[i]<<(7-(i%8));
         }
 
+        m_dsdDecoder->pushDVFrame(0, errs); // Indicate that a DVSI frame is available
         m_dsdDecoder->m_mbeDecoder1.processData((char *) m_vfrBits, 0);
-        m_dsdDecoder->m_mbeDVReady1 = true; // Indicate that a DVSI frame is available
 	}
 }
 
@@ -854,34 +855,43 @@ void DSDYSF::storeSymbolDV(unsigned char *mbeFrame, int dibitindex, unsigned cha
     mbeFrame[dibitindex/4] |= (dibit << (6 - 2*(dibitindex % 4)));
 }
 
+void DSDYSF::storeSoftDibit(unsigned char *softBits, int index)
+{
+    DSDSymbol::DSDSoftDibit softDibit = m_dsdDecoder->m_dsdSymbol.getSoftDibit();
+    softBits[2*index]     = softDibit.m_lsb; // symbol bit 0 first as in Viterbi::decodeFromBits
+    softBits[2*index + 1] = softDibit.m_msb;
+}
+
 bool DSDYSF::checkCRC16(unsigned char *bits,  unsigned long nbBytes, unsigned char *xoredBytes)
 {
-    unsigned char bytes[22];
-//    std::cerr << "DSDYSF::checkCRC16: value: ";
+    DSD_PERF_TIMER(m_dsdDecoder->m_perfStats, DSDPerfStats::DSDPerfCRC);
 
-    for (int i = 0; i < nbBytes+2; i++)
+    if (xoredBytes)
     {
-        bytes[i] = (bits[8*i+0]<<7)
-                + (bits[8*i+1]<<6)
-                + (bits[8*i+2]<<5)
-                + (bits[8*i+3]<<4)
-                + (bits[8*i+4]<<3)
-                + (bits[8*i+5]<<2)
-                + (bits[8*i+6]<<1)
-                + (bits[8*i+7]<<0);
-
-        if (xoredBytes)
+        for (int i = 0; i < nbBytes+2; i++)
         {
-            xoredBytes[i] = bytes[i] ^ m_pn.getByte(i);
+            xoredBytes[i] = ((bits[8*i+0]<<7)
+                    + (bits[8*i+1]<<6)
+                    + (bits[8*i+2]<<5)
+                    + (bits[8*i+3]<<4)
+                    + (bits[8*i+4]<<3)
+                    + (bits[8*i+5]<<2)
+                    + (bits[8*i+6]<<1)
+                    + (bits[8*i+7]<<0)) ^ m_pn.getByte(i);
         }
-//        std::cerr << std::hex << (int) bytes[i] << " ";
     }
 
-    unsigned int crc = (bytes[nbBytes]<<8) + bytes[nbBytes+1];
+    unsigned int crc = 0;
+
+    for (int i = 0; i < 16; i++) {
+        crc = (crc << 1) + bits[8*nbBytes + i];
+    }
 
-//    std::cerr << "crc: " << std::hex << crc << std::endl;
+//    std::cerr << "DSDYSF::checkCRC16: crc: " << std::hex << crc << std::endl;
 
-    return m_crc.crctablefast(bytes, nbBytes) == crc;
+    bool ok = m_crc.crcbits(bits, 8*nbBytes) == crc;
+    m_dsdDecoder->countCheck(DSDDecoder::DSDCheckYSFCRC16, ok);
+    return ok;
 }
 
 void DSDYSF::scrambleVFR(uint8_t out[], uint8_t in[], uint16_t n, uint32_t seed, uint8_t shift)
@@ -188,8 +188,8 @@ public:
 
 private:
 
-    void processFICH(int symbolIndex, unsigned char dibit);
-    void processHeader(int symbolIndex, unsigned char dibit);
+    void processFICH(int symbolIndex);
+    void processHeader(int symbolIndex);
     void processVD1(int symbolIndex, unsigned char dibit);
     void processVD2(int symbolIndex, unsigned char dibit);
     void processVD2Voice(int mbeIndex, unsigned char dibit);
@@ -204,22 +204,23 @@ private:
     void procesVFRFrame(int mbeIndex, unsigned char dibit);
     void storeSymbolDV(unsigned char *mbeFrame, int dibitindex, unsigned char dibit, bool invertDibit = false);
 
+    void storeSoftDibit(unsigned char *softBits, int index); //!< store soft bits of current dibit at dibit index for soft Viterbi decoding
     bool checkCRC16(unsigned char *bits, unsigned long nbBytes, unsigned char *xoredBytes = 0);
     void scrambleVFR(uint8_t out[], uint8_t in[], uint16_t n, uint32_t seed, uint8_t shift);
 
     DSDDecoder *m_dsdDecoder;
     int m_symbolIndex;                //!< Current symbol index
 
-    unsigned char m_fichRaw[100];     //!< FICH dibits after de-interleave + Viterbi stuff symbols
+    unsigned char m_fichRaw[2*100];   //!< FICH soft bits after de-interleave + Viterbi stuff symbols (see storeSoftDibit)
     unsigned char m_fichGolay[100];   //!< FICH Golay encoded bits + 4 stuff bits + Viterbi stuff bits
     unsigned char m_fichBits[48];     //!< Final FICH + CRC16
     FICH          m_fich;             //!< Validated FICH
     FICHError     m_fichError;        //!< FICH decoding error status
 
-    unsigned char m_dch1Raw[180];     //!< DCH1 dibits after de-interleave
+    unsigned char m_dch1Raw[2*180];   //!< DCH1 soft bits after de-interleave
     unsigned char m_dch1Bits[180];    //!< DCH1 bits after de-convolution
 
-    unsigned char m_dch2Raw[180];     //!< DCH2 dibits after de-interleave
+    unsigned char m_dch2Raw[2*180];   //!< DCH2 soft bits after de-interleave
     unsigned char m_dch2Bits[180];    //!< DCH2 bits after de-convolution
 
     unsigned char m_vd2BitsRaw[104];  //!< V/D type 2 VCH+VeCH after de-interleave and de-whitening
@@ -229,8 +230,7 @@ private:
     unsigned char m_vfrBits[88];      //!< VFR bits after FEC
     bool m_vfrStart;
 
-    Viterbi5 m_viterbiFICH;
-    Golay_24_12 m_golay_24_12;
+    Viterbi5 m_viterbiFICH;           //!< FICH and DCH decoder with path memory reserved for the 180 symbols of a DCH
     CRC m_crc;
     PN_9_5 m_pn;
     unsigned char m_bitWork[48];